@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// First-order forward mode whose tangent carries AADVec::Width seed directions
+// at once: the primal is computed a single time per pass while all directional
+// derivatives propagate together in one SIMD register (8 doubles = one AVX-512
+// register, two AVX2 registers).
+class AADVec {
+public:
+    static constexpr size_t Width = 8;
+
+    AADVec() : m_val(0), m_d1{} {
+    }
+
+    explicit AADVec(double v) : m_val(v), m_d1{} {
+    }
+
+    // seeds the unit tangent e_direction
+    AADVec(size_t direction, double v) : m_val(v), m_d1{} {
+        if (direction < Width) {
+            m_d1[direction] = 1;
+        }
+    }
+
+    AADVec(double v, const std::array<double, Width> &seed);
+
+    AADVec operator+() const;
+    AADVec operator-() const;
+
+    AADVec &operator+=(const AADVec &rhs);
+    AADVec &operator-=(const AADVec &rhs);
+    AADVec &operator*=(const AADVec &rhs);
+    AADVec &operator/=(const AADVec &rhs);
+
+    AADVec operator+(const AADVec &rhs) const;
+    AADVec operator-(const AADVec &rhs) const;
+    AADVec operator*(const AADVec &rhs) const;
+    AADVec operator/(const AADVec &rhs) const;
+
+    AADVec &operator+=(double rhs);
+    AADVec &operator-=(double rhs);
+    AADVec &operator*=(double rhs);
+    AADVec &operator/=(double rhs);
+
+    AADVec operator+(double rhs) const;
+    AADVec operator-(double rhs) const;
+    AADVec operator*(double rhs) const;
+    AADVec operator/(double rhs) const;
+
+    friend AADVec sin(const AADVec &arg);
+    friend AADVec cos(const AADVec &arg);
+    friend AADVec exp(const AADVec &arg);
+
+    [[nodiscard]] double get_value() const;
+    [[nodiscard]] double get_derivative(size_t direction) const;
+
+private:
+    // GCC/Clang vector extension: element-wise arithmetic maps onto one zmm
+    // register with AVX-512 and is split by the compiler on narrower targets
+    typedef double Tangent __attribute__((vector_size(Width * sizeof(double))));
+
+    double m_val;
+    Tangent m_d1;
+};
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
 #include "aad.h"
+#include "aad_vec.h"
 #include "enum.h"
 
 template <typename Callable, Derivative D>
@@ -106,3 +109,24 @@ double Differentiator(Callable F, double x, double y) {
         return F(AAD22(Variable::X, x), AAD22(Variable::Y, y)).get_derivative(D);
     }
 }
+
+// ============= FULL GRADIENT VIA VECTOR FORWARD MODE (AADVec) =============
+
+// F maps std::array<AADVec, N> to AADVec. Each pass seeds AADVec::Width inputs,
+// so the primal is evaluated ceil(N / Width) times instead of ceil(N / 2).
+template <size_t N, typename Callable>
+std::array<double, N> Gradient(Callable F, const std::array<double, N> &x) {
+    std::array<double, N> grad = {};
+    for (size_t first = 0; first < N; first += AADVec::Width) {
+        size_t last = std::min(N, first + AADVec::Width);
+        std::array<AADVec, N> args;
+        for (size_t i = 0; i < N; ++i) {
+            args[i] = (i >= first && i < last) ? AADVec(i - first, x[i]) : AADVec(x[i]);
+        }
+        AADVec res = F(args);
+        for (size_t i = first; i < last; ++i) {
+            grad[i] = res.get_derivative(i - first);
+        }
+    }
+    return grad;
+}
@@ -0,0 +1,158 @@
+#include "aad_vec.h"
+#include <cmath>
+#include <stdexcept>
+
+// ================ AADVec CONSTRUCTORS & GETTERS IMPLEMENTATION ================
+
+AADVec::AADVec(double v, const std::array<double, Width> &seed) : m_val(v), m_d1{} {
+    for (size_t i = 0; i < Width; ++i) {
+        m_d1[i] = seed[i];
+    }
+}
+
+double AADVec::get_value() const {
+    return m_val;
+}
+
+double AADVec::get_derivative(size_t direction) const {
+    if (direction >= Width) {
+        return 0;
+    }
+    return m_d1[direction];
+}
+
+// ================ AADVec OPERATORS IMPLEMENTATION ================
+
+AADVec AADVec::operator+() const {
+    return *this;
+}
+
+AADVec AADVec::operator-() const {
+    AADVec result;
+    result.m_val = -m_val;
+    result.m_d1 = -m_d1;
+    return result;
+}
+
+AADVec &AADVec::operator+=(const AADVec &rhs) {
+    m_val += rhs.m_val;
+    m_d1 += rhs.m_d1;
+    return *this;
+}
+
+AADVec AADVec::operator+(const AADVec &rhs) const {
+    AADVec result = *this;
+    result += rhs;
+    return result;
+}
+
+AADVec &AADVec::operator-=(const AADVec &rhs) {
+    m_val -= rhs.m_val;
+    m_d1 -= rhs.m_d1;
+    return *this;
+}
+
+AADVec AADVec::operator-(const AADVec &rhs) const {
+    AADVec result = *this;
+    result -= rhs;
+    return result;
+}
+
+AADVec &AADVec::operator*=(const AADVec &rhs) {
+    m_d1 = m_d1 * rhs.m_val + m_val * rhs.m_d1;
+    m_val *= rhs.m_val;
+    return *this;
+}
+
+AADVec AADVec::operator*(const AADVec &rhs) const {
+    AADVec result = *this;
+    result *= rhs;
+    return result;
+}
+
+AADVec &AADVec::operator/=(const AADVec &rhs) {
+    if (rhs.m_val == 0.0) {
+        throw std::runtime_error("Division by zero\n");
+    }
+    m_val /= rhs.m_val;
+    m_d1 = (m_d1 - m_val * rhs.m_d1) / rhs.m_val;
+    return *this;
+}
+
+AADVec AADVec::operator/(const AADVec &rhs) const {
+    AADVec result = *this;
+    result /= rhs;
+    return result;
+}
+
+AADVec &AADVec::operator+=(const double rhs) {
+    m_val += rhs;
+    return *this;
+}
+
+AADVec AADVec::operator+(const double rhs) const {
+    AADVec result = *this;
+    result += rhs;
+    return result;
+}
+
+AADVec &AADVec::operator-=(const double rhs) {
+    m_val -= rhs;
+    return *this;
+}
+
+AADVec AADVec::operator-(const double rhs) const {
+    AADVec result = *this;
+    result -= rhs;
+    return result;
+}
+
+AADVec &AADVec::operator*=(const double rhs) {
+    m_val *= rhs;
+    m_d1 *= rhs;
+    return *this;
+}
+
+AADVec AADVec::operator*(const double rhs) const {
+    AADVec result = *this;
+    result *= rhs;
+    return result;
+}
+
+AADVec &AADVec::operator/=(const double rhs) {
+    if (rhs == 0.0) {
+        throw std::runtime_error("Division by zero\n");
+    }
+    m_val /= rhs;
+    m_d1 /= rhs;
+    return *this;
+}
+
+AADVec AADVec::operator/(const double rhs) const {
+    AADVec result = *this;
+    result /= rhs;
+    return result;
+}
+
+// ================ AADVec FUNCTIONS IMPLEMENTATION ================
+
+AADVec sin(const AADVec &arg) {
+    AADVec res;
+    res.m_val = std::sin(arg.m_val);
+    res.m_d1 = std::cos(arg.m_val) * arg.m_d1;
+    return res;
+}
+
+AADVec cos(const AADVec &arg) {
+    AADVec res;
+    res.m_val = std::cos(arg.m_val);
+    res.m_d1 = -std::sin(arg.m_val) * arg.m_d1;
+    return res;
+}
+
+AADVec exp(const AADVec &arg) {
+    AADVec res;
+    res.m_val = std::exp(arg.m_val);
+    res.m_d1 = res.m_val * arg.m_d1;
+    return res;
+}
@@ -2,6 +2,7 @@
 #include <functional>
 #include <iostream>
 #include "aad.h"
+#include "aad_vec.h"
 #include "differentiator.h"
 
 double F(double x, double y) {
@@ -206,6 +207,48 @@ int main() {
         std::cout << std::endl;
     }
 
+    {
+        constexpr size_t N = 12;
+
+        auto af = [](const std::array<AADVec, N> &x) {
+            AADVec s;
+            for (size_t i = 0; i < N; ++i) {
+                s += sin(x[i]) * x[(i + 1) % N];
+            }
+            return exp(s / N);
+        };
+
+        auto grad = [](const std::array<double, N> &x) {
+            double s = 0;
+            for (size_t i = 0; i < N; ++i) {
+                s += std::sin(x[i]) * x[(i + 1) % N];
+            }
+            std::array<double, N> g;
+            for (size_t i = 0; i < N; ++i) {
+                g[i] = std::exp(s / N) *
+                       (std::cos(x[i]) * x[(i + 1) % N] + std::sin(x[(i + N - 1) % N])) / N;
+            }
+            return g;
+        };
+
+        double err_vec = 0;
+        for (double t = -2; t <= 2; t += 0.01) {
+            std::array<double, N> x;
+            for (size_t i = 0; i < N; ++i) {
+                x[i] = t + 0.1 * i;
+            }
+            std::array<double, N> g = grad(x), ag = Gradient<N>(af, x);
+            for (size_t i = 0; i < N; ++i) {
+                err_vec = std::max(err_vec, std::abs(g[i] - ag[i]));
+            }
+        }
+        std::cout << "... TESTING GRADIENT OF F = exp(sum sin(x_i) x_{i+1} / 12), "
+                     "x_i = t + i / 10, t ∈ [-2, 2]"
+                  << std::endl;
+        std::cout << "=>  AAD VEC (8 directions, 2 passes): " << err_vec << std::endl;
+        std::cout << std::endl;
+    }
+
     // LOCAL RESULTS
     // ... TESTING F = cos(5x) / (x^2 + y^2), (x, y) ∈ [-50, 50] x [1, 100]
     // =>  STENCIL3     : 3.99989e-08
@@ -241,6 +284,9 @@ int main() {
     // =>  STENCIL5     : 5.11332e-07
     // =>  STENCIL5EXTRA: 8.88344e-05
     // =>  AAD          : 4.54747e-13
+    //
+    // ... TESTING GRADIENT OF F = exp(sum sin(x_i) x_{i+1} / 12), x_i = t + i / 10, t ∈ [-2, 2]
+    // =>  AAD VEC (8 directions, 2 passes): 1.11022e-16
 
     return 0;
 }
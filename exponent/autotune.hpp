@@ -0,0 +1,287 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "exp.hpp"
+#include "exp_simd.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace ADAAI {
+
+// Run-time choice of the fastest Exp method that meets an ulp bound on this
+// CPU. The first call for a (type, bound) pair measures every eligible method
+// (bench.hpp) and binds plain function pointers; the choice is appended to a
+// cache file keyed by cache version, CPU model, type and bound, so later
+// processes only read it. All candidates use the Cody-Waite reduction.
+
+template <typename F>
+struct TunedExp {
+    std::string scalar_name;
+    F (*scalar)(F) = nullptr;  // y = exp(x)
+    std::string array_name;
+    void (*array)(const F *, F *, size_t) = nullptr;  // y[i] = exp(x[i])
+    bool from_cache = false;
+};
+
+namespace tune {
+
+template <Method M, typename F>
+F expScalar(F a_x) {
+    return Exp<M, F, 32, Scheme::Horner, Reduction::CodyWaite>(a_x);
+}
+
+template <Method M, typename F>
+void expArray(const F *a_x, F *a_y, size_t a_n) {
+    for (size_t i = 0; i < a_n; ++i) {
+        a_y[i] = Exp<M, F, 32, Scheme::Horner, Reduction::CodyWaite>(a_x[i]);
+    }
+}
+
+template <typename F>
+void expN(const F *a_x, F *a_y, size_t a_n) {
+    ExpN<F>({a_x, a_n}, {a_y, a_n});
+}
+
+template <typename F>
+struct Entry {
+    const char *name;
+    F (*scalar)(F);  // nullptr for array-only entries
+    void (*array)(const F *, F *, size_t);
+};
+
+template <typename F>
+std::vector<Entry<F>> entries() {
+    std::vector<Entry<F>> e = {
+        {"taylor", expScalar<Method::Taylor, F>, expArray<Method::Taylor, F>},
+        {"minimax", expScalar<Method::Minimax, F>, expArray<Method::Minimax, F>},
+        {"pade", expScalar<Method::Pade, F>, expArray<Method::Pade, F>},
+        {"chebyshev", expScalar<Method::Chebyshev, F>, expArray<Method::Chebyshev, F>},
+        {"table", expScalar<Method::Table, F>, expArray<Method::Table, F>},
+    };
+    if constexpr (!std::is_same_v<F, long double>) {
+        e.push_back({"simd", nullptr, expN<F>});
+    }
+    return e;
+}
+
+template <typename F>
+const char *typeName() {
+    if constexpr (std::is_same_v<F, float>) {
+        return "float";
+    } else if constexpr (std::is_same_v<F, double>) {
+        return "double";
+    } else {
+        return "long-double";
+    }
+}
+
+// CPU model string, spaces replaced so that it stays one cache-file field
+inline std::string cpuModel() {
+    std::string model = "generic";
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned regs[12] = {};
+    if (__get_cpuid_max(0x80000000, nullptr) >= 0x80000004) {
+        for (unsigned i = 0; i < 3; ++i) {
+            __get_cpuid(
+                0x80000002 + i, &regs[4 * i], &regs[4 * i + 1], &regs[4 * i + 2],
+                &regs[4 * i + 3]
+            );
+        }
+        model.assign(reinterpret_cast<const char *>(regs), sizeof(regs));
+        model = model.substr(0, model.find('\0'));
+    }
+#endif
+    std::string res;
+    for (char c : model) {
+        if (c != ' ' || (!res.empty() && res.back() != '_')) {
+            res += c == ' ' ? '_' : c;
+        }
+    }
+    while (!res.empty() && res.back() == '_') {
+        res.pop_back();
+    }
+    return res.empty() ? "generic" : res;
+}
+
+// $ADAAI_EXP_TUNE_CACHE, else $HOME/.cache/adaai-exp.tune, else the working
+// directory
+inline std::string defaultCachePath() {
+    if (const char *path = std::getenv("ADAAI_EXP_TUNE_CACHE")) {
+        return path;
+    }
+    if (const char *home = std::getenv("HOME")) {
+        return std::string(home) + "/.cache/adaai-exp.tune";
+    }
+    return "adaai-exp.tune";
+}
+
+// revision of the cache lines and of the candidates they name: bump it when
+// the line layout, the entries or their kernels change, so that choices made
+// by an older build are tuned again
+constexpr inline int CacheVersion = 1;
+
+// the bound is written exactly (hex float), so distinct bounds never share a key
+inline std::string cacheKey(const char *a_type, double a_max_ulp) {
+    char bound[32];
+    std::snprintf(bound, sizeof(bound), "%a", a_max_ulp);
+    return "v" + std::to_string(CacheVersion) + " " + cpuModel() + " " + a_type + " " +
+           bound;
+}
+
+// cache lines: "v<version> <cpu> <type> <max ulp> <scalar method> <array method>";
+// the last line for a key wins
+inline bool readCache(
+    const std::string &a_path,
+    const std::string &a_key,
+    std::string &a_scalar,
+    std::string &a_array
+) {
+    std::ifstream in(a_path);
+    bool found = false;
+    for (std::string line; std::getline(in, line);) {
+        std::istringstream ss(line);
+        std::string version, cpu, type, bound, scalar, array;
+        if (line.empty() || line[0] == '#' ||
+            !(ss >> version >> cpu >> type >> bound >> scalar >> array)) {
+            continue;
+        }
+        if (version + " " + cpu + " " + type + " " + bound == a_key) {
+            a_scalar = scalar, a_array = array, found = true;
+        }
+    }
+    return found;
+}
+
+inline void appendCache(
+    const std::string &a_path,
+    const std::string &a_key,
+    const std::string &a_scalar,
+    const std::string &a_array
+) {
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(a_path).parent_path(), ec);
+    std::ofstream out(a_path, std::ios::app);
+    if (out) {  // an unwritable cache only costs a re-tune next time
+        out << a_key << " " << a_scalar << " " << a_array << "\n";
+    }
+}
+
+// inputs the accuracy of a candidate is judged on: the whole finite range
+// and, denser, the reduced interval
+template <typename F>
+std::vector<F> accuracyInputs() {
+    std::vector<F> x;
+    const int n = 1 << 14;
+    for (int i = 0; i <= n; ++i) {
+        x.push_back(ExpMin<F>() + (ExpMax<F>() - ExpMin<F>()) * static_cast<F>(i) / n);
+        x.push_back(static_cast<F>(-1) + static_cast<F>(2 * i) / n);
+    }
+    return x;
+}
+
+template <typename F>
+bench::Candidate<F> asCandidate(const Entry<F> &a_entry) {
+    return {a_entry.name, nullptr, a_entry.array};
+}
+
+template <typename F>
+bool meetsBound(const Entry<F> &a_entry, const std::vector<F> &a_x, double a_max_ulp) {
+    return bench::accuracy(asCandidate(a_entry), a_x).max_ulp <= a_max_ulp;
+}
+
+// measures every entry within a_max_ulp and returns the fastest scalar and
+// array bindings; a binding no entry qualifies for stays nullptr
+template <typename F>
+TunedExp<F> measureBest(double a_max_ulp) {
+    const std::vector<F> acc_x = accuracyInputs<F>();
+    std::vector<F> x(4096), y(4096);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<F>(-20) + static_cast<F>(40) * static_cast<F>(i) / x.size();
+    }
+
+    TunedExp<F> best;
+    double best_scalar = std::numeric_limits<double>::infinity();
+    double best_array = std::numeric_limits<double>::infinity();
+    for (const Entry<F> &e : entries<F>()) {
+        if (!meetsBound(e, acc_x, a_max_ulp)) {
+            continue;
+        }
+        if (e.scalar) {
+            // called through the pointer, the way the binding will be used
+            F (*fn)(F) = e.scalar;
+            auto cand = bench::scalarCandidate<F>(e.name, [fn](F v) { return fn(v); });
+            double ns = bench::throughput(cand, x, y, 20, 5).ns;
+            if (ns < best_scalar) {
+                best_scalar = ns, best.scalar_name = e.name, best.scalar = e.scalar;
+            }
+        }
+        double ns = bench::throughput(asCandidate(e), x, y, 20, 5).ns;
+        if (ns < best_array) {
+            best_array = ns, best.array_name = e.name, best.array = e.array;
+        }
+    }
+    return best;
+}
+
+}  // namespace tune
+
+// The fastest methods within a_max_ulp (measured on the whole finite range)
+// for F on this CPU. Tuned once per process and bound; a_cache = "" disables
+// the cache file. std::nullopt when no scalar or no array method meets the
+// bound; that outcome is not cached. Thread-safe.
+template <typename F>
+std::optional<TunedExp<F>>
+tunedExp(double a_max_ulp = 4, const std::string &a_cache = tune::defaultCachePath()) {
+    static std::mutex mutex;
+    static std::map<double, std::optional<TunedExp<F>>> tuned;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto it = tuned.find(a_max_ulp); it != tuned.end()) {
+        return it->second;
+    }
+
+    const std::string key = tune::cacheKey(tune::typeName<F>(), a_max_ulp);
+    TunedExp<F> res;
+    std::string scalar, array;
+    if (!a_cache.empty() && tune::readCache(a_cache, key, scalar, array)) {
+        // the accuracy of a cached choice is checked again, which costs little
+        // next to the timing runs the cache saves
+        const std::vector<F> acc_x = tune::accuracyInputs<F>();
+        for (const tune::Entry<F> &e : tune::entries<F>()) {
+            if ((scalar != e.name && array != e.name) ||
+                !tune::meetsBound(e, acc_x, a_max_ulp)) {
+                continue;
+            }
+            if (e.scalar && scalar == e.name) {
+                res.scalar_name = e.name, res.scalar = e.scalar;
+            }
+            if (array == e.name) {
+                res.array_name = e.name, res.array = e.array;
+            }
+        }
+        res.from_cache = true;
+    }
+    if (!res.scalar || !res.array) {  // not cached, unknown names or out of bound
+        res = tune::measureBest<F>(a_max_ulp);
+        if (!res.scalar || !res.array) {
+            return tuned.emplace(a_max_ulp, std::nullopt).first->second;
+        }
+        if (!a_cache.empty()) {
+            tune::appendCache(a_cache, key, res.scalar_name, res.array_name);
+        }
+    }
+    return tuned.emplace(a_max_ulp, res).first->second;
+}
+
+}  // namespace ADAAI
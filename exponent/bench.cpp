@@ -0,0 +1,202 @@
+// Latency, throughput and accuracy of every Exp method for float, double and
+// long double next to std::exp and ExpN, as CSV or JSON for regression
+// tracking:
+//
+//   ./exp-bench [--format csv|json] [--out FILE] [--n N] [--range R]
+//               [--rounds K] [--repeats K]
+//
+// latency:    ns and TSC cycles per call of a dependent chain
+// throughput: ns and TSC cycles per element over N independent inputs in
+//             [-R, R] (N = 4096 keeps them in L1)
+// accuracy:   max and mean ulp against expl over the same inputs
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "exp.hpp"
+#include "exp_simd.hpp"
+
+using namespace ADAAI;
+
+namespace {
+
+constexpr size_t Capacity = 50;
+
+struct Options {
+    std::string format = "csv";
+    std::string out;
+    size_t n = 4096;
+    double range = 20;
+    int rounds = 200;
+    int repeats = 7;
+};
+
+struct Row {
+    std::string type, method;
+    bench::Timing latency, throughput;
+    bench::Accuracy accuracy;
+};
+
+template <typename F>
+std::vector<bench::Candidate<F>> candidates(std::span<const F> samples) {
+    using bench::scalarCandidate;
+    constexpr Reduction CW = Reduction::CodyWaite;
+    std::vector<bench::Candidate<F>> c = {
+        scalarCandidate<F>("std::exp", [](F x) { return std::exp(x); }),
+        scalarCandidate<F>("taylor", [](F x) { return Exp<Method::Taylor, F, Capacity>(x); }),
+        scalarCandidate<F>(
+            "taylor-cw",
+            [](F x) { return Exp<Method::Taylor, F, Capacity, Scheme::Horner, CW>(x); }
+        ),
+        scalarCandidate<F>("minimax", [](F x) { return Exp<Method::Minimax, F, Capacity>(x); }),
+        scalarCandidate<F>(
+            "minimax-cw",
+            [](F x) { return Exp<Method::Minimax, F, Capacity, Scheme::Horner, CW>(x); }
+        ),
+        scalarCandidate<F>("pade", [](F x) { return Exp<Method::Pade, F, Capacity>(x); }),
+        scalarCandidate<F>(
+            "chebyshev", [](F x) { return Exp<Method::Chebyshev, F, Capacity>(x); }
+        ),
+        scalarCandidate<F>("table", [](F x) { return Exp<Method::Table, F, Capacity>(x); }),
+        scalarCandidate<F>(
+            "table-cw",
+            [](F x) { return Exp<Method::Table, F, Capacity, Scheme::Horner, CW>(x); }
+        ),
+        scalarCandidate<F>(
+            "fourier",
+            [samples](F x) { return Exp<Method::Fourier, F, Capacity>(x, samples); }
+        ),
+        scalarCandidate<F>("tol-1e-6", [](F x) { return ExpTol<1e-6L>(x); }),
+    };
+    if constexpr (!std::is_same_v<F, long double>) {
+        c.push_back({"ExpN", nullptr, [](const F *x, F *y, size_t n) {
+                         ExpN<F>({x, n}, {y, n});
+                     }});
+    }
+    return c;
+}
+
+template <typename F>
+void run(const std::string &a_typename, const Options &a_opt, std::vector<Row> &a_rows) {
+    std::vector<F> coef_fft(1024, 0);
+    chebyshevGaussQuadrature(1023, coef_fft);
+    std::vector<F> samples = fourierSamples(coef_fft);
+
+    std::mt19937_64 gen(2024);
+    std::uniform_real_distribution<double> dist(-a_opt.range, a_opt.range);
+    std::vector<F> x(a_opt.n), y(a_opt.n);
+    for (F &v : x) {
+        v = static_cast<F>(dist(gen));
+    }
+
+    for (const auto &cand : candidates<F>(samples)) {
+        a_rows.push_back(Row{
+            a_typename,
+            cand.name,
+            bench::latency(cand, a_opt.n * a_opt.rounds / 4, a_opt.repeats),
+            bench::throughput(cand, x, y, a_opt.rounds, a_opt.repeats),
+            bench::accuracy(cand, x),
+        });
+    }
+}
+
+void writeCsv(std::ostream &a_os, const std::vector<Row> &a_rows) {
+    a_os << "type,method,latency_ns,latency_cycles,throughput_ns,throughput_cycles,"
+            "max_ulp,mean_ulp\n";
+    for (const Row &r : a_rows) {
+        a_os << r.type << ',' << r.method << ',' << r.latency.ns << ','
+             << r.latency.cycles << ',' << r.throughput.ns << ',' << r.throughput.cycles
+             << ',' << r.accuracy.max_ulp << ',' << r.accuracy.mean_ulp << '\n';
+    }
+}
+
+// JSON has no NaN / inf: those become null
+template <typename T>
+std::string jsonNumber(T a_value) {
+    if (!std::isfinite(a_value)) {
+        return "null";
+    }
+    std::ostringstream ss;
+    ss << std::setprecision(6) << a_value;
+    return ss.str();
+}
+
+void writeJson(std::ostream &a_os, const std::vector<Row> &a_rows) {
+    a_os << "[\n";
+    for (size_t i = 0; i < a_rows.size(); ++i) {
+        const Row &r = a_rows[i];
+        a_os << "  {\"type\": \"" << r.type << "\", \"method\": \"" << r.method
+             << "\", \"latency_ns\": " << jsonNumber(r.latency.ns)
+             << ", \"latency_cycles\": " << jsonNumber(r.latency.cycles)
+             << ", \"throughput_ns\": " << jsonNumber(r.throughput.ns)
+             << ", \"throughput_cycles\": " << jsonNumber(r.throughput.cycles)
+             << ", \"max_ulp\": " << jsonNumber(r.accuracy.max_ulp)
+             << ", \"mean_ulp\": " << jsonNumber(r.accuracy.mean_ulp) << "}"
+             << (i + 1 < a_rows.size() ? "," : "") << "\n";
+    }
+    a_os << "]\n";
+}
+
+int usage(const char *a_argv0) {
+    std::cerr << "usage: " << a_argv0
+              << " [--format csv|json] [--out FILE] [--n N] [--range R]"
+                 " [--rounds K] [--repeats K]"
+              << std::endl;
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--format") == 0 && has_value) {
+            opt.format = argv[++i];
+        } else if (std::strcmp(argv[i], "--out") == 0 && has_value) {
+            opt.out = argv[++i];
+        } else if (std::strcmp(argv[i], "--n") == 0 && has_value) {
+            opt.n = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--range") == 0 && has_value) {
+            opt.range = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--rounds") == 0 && has_value) {
+            opt.rounds = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--repeats") == 0 && has_value) {
+            opt.repeats = std::atoi(argv[++i]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if ((opt.format != "csv" && opt.format != "json") || opt.n == 0 || opt.rounds < 1 ||
+        opt.repeats < 1) {
+        return usage(argv[0]);
+    }
+
+    std::vector<Row> rows;
+    run<float>("float", opt, rows);
+    run<double>("double", opt, rows);
+    run<long double>("long double", opt, rows);
+
+    std::ofstream file;
+    if (!opt.out.empty()) {
+        file.open(opt.out);
+        if (!file) {
+            std::cerr << "cannot open " << opt.out << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &os = opt.out.empty() ? std::cout : file;
+    if (opt.format == "json") {
+        writeJson(os, rows);
+    } else {
+        writeCsv(os, rows);
+    }
+    return 0;
+}
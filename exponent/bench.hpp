@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ulp.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ADAAI_HAVE_RDTSC 1
+#else
+#define ADAAI_HAVE_RDTSC 0
+#endif
+
+namespace ADAAI::bench {
+
+// time stamp counter; counts reference cycles at the nominal frequency, not
+// core cycles, so it drifts from the true count under turbo or throttling
+inline uint64_t readTsc() {
+#if ADAAI_HAVE_RDTSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Timing {
+    double ns = std::numeric_limits<double>::infinity();  // per element
+    double cycles = std::numeric_limits<double>::infinity();  // per element
+};
+
+// keeps a value alive without letting the compiler see how it is used
+template <typename T>
+inline void doNotOptimize(const T &a_value) {
+    asm volatile("" : : "r,m"(a_value) : "memory");
+}
+
+// best of a_repeats runs of a_run(), which processes a_elements elements
+template <typename Run>
+Timing measure(Run a_run, size_t a_elements, int a_repeats) {
+    Timing best;
+    for (int r = 0; r < a_repeats; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = readTsc();
+        a_run();
+        uint64_t c1 = readTsc();
+        auto t1 = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        best.ns = std::min(best.ns, ns / a_elements);
+        if (ADAAI_HAVE_RDTSC) {
+            best.cycles = std::min(best.cycles, static_cast<double>(c1 - c0) / a_elements);
+        }
+    }
+    if (!ADAAI_HAVE_RDTSC) {
+        best.cycles = std::numeric_limits<double>::quiet_NaN();
+    }
+    return best;
+}
+
+// One way of computing exp, with the call inlined into both loops:
+//   chain(x0, n) -- n dependent calls, x_{i+1} = exp(x_i) * 1e-3 - 0.3, for
+//                   latency (includes the latency of that one fma)
+//   block(x, y, n) -- y[i] = exp(x[i]), independent, for throughput
+// chain is empty for array-only APIs.
+template <typename F>
+struct Candidate {
+    std::string name;
+    std::function<F(F, size_t)> chain;
+    std::function<void(const F *, F *, size_t)> block;
+};
+
+template <typename F, typename Fn>
+Candidate<F> scalarCandidate(std::string a_name, Fn a_exp) {
+    return {
+        std::move(a_name),
+        [a_exp](F x, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                x = a_exp(x) * static_cast<F>(1e-3) - static_cast<F>(0.3);
+            }
+            return x;
+        },
+        [a_exp](const F *x, F *y, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = a_exp(x[i]);
+            }
+        },
+    };
+}
+
+template <typename F>
+Timing latency(const Candidate<F> &a_cand, size_t a_calls, int a_repeats) {
+    if (!a_cand.chain) {
+        return {
+            std::numeric_limits<double>::quiet_NaN(),
+            std::numeric_limits<double>::quiet_NaN()};
+    }
+    return measure(
+        [&] { doNotOptimize(a_cand.chain(static_cast<F>(0.1), a_calls)); }, a_calls,
+        a_repeats
+    );
+}
+
+// a_rounds passes over the inputs per run; the inputs should fit into L1
+template <typename F>
+Timing throughput(
+    const Candidate<F> &a_cand,
+    const std::vector<F> &a_x,
+    std::vector<F> &a_y,
+    int a_rounds,
+    int a_repeats
+) {
+    return measure(
+        [&] {
+            for (int r = 0; r < a_rounds; ++r) {
+                a_cand.block(a_x.data(), a_y.data(), a_x.size());
+                doNotOptimize(a_y.data());
+            }
+        },
+        a_x.size() * a_rounds, a_repeats
+    );
+}
+
+struct Accuracy {
+    long double max_ulp = 0;
+    long double mean_ulp = 0;
+};
+
+// ulp error of the candidate against expl on a_x
+template <typename F>
+Accuracy accuracy(const Candidate<F> &a_cand, const std::vector<F> &a_x) {
+    std::vector<F> y(a_x.size());
+    a_cand.block(a_x.data(), y.data(), a_x.size());
+    Accuracy acc;
+    for (size_t i = 0; i < a_x.size(); ++i) {
+        long double err = UlpError(y[i], std::exp(static_cast<long double>(a_x[i])));
+        acc.max_ulp = std::max(acc.max_ulp, err);
+        acc.mean_ulp += err;
+    }
+    acc.mean_ulp /= static_cast<long double>(std::max<size_t>(a_x.size(), 1));
+    return acc;
+}
+
+}  // namespace ADAAI::bench
@@ -0,0 +1,93 @@
+// Builds the Fourier sample file of Exp<Method::Fourier> once, so that worker
+// processes only map it (coef_store.hpp), and compares the two start-up paths:
+//
+//   ./coef-store [--n N] [--type float|double|long-double] [--out FILE]
+//
+// N is the number of Chebyshev-Gauss coefficients (even, default 2^16).
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "coef_store.hpp"
+
+using namespace ADAAI;
+
+namespace {
+
+template <typename F>
+int run(const std::string &a_path, size_t a_n) {
+    using Clock = std::chrono::steady_clock;
+    auto ms = [](Clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+
+    auto t0 = Clock::now();
+    std::vector<F> coefs(a_n, 0);
+    chebyshevGaussQuadrature(static_cast<int>(a_n) - 1, coefs);
+    std::vector<F> samples = fourierSamples(coefs);
+    auto t1 = Clock::now();
+    writeCoefFile<F>(a_path, CoefMethod::FourierSamples, a_n, samples);
+    auto t2 = Clock::now();
+    MappedCoefs<F> store(a_path, CoefMethod::FourierSamples);
+    auto t3 = Clock::now();
+
+    F x = static_cast<F>(0.3);
+    F diff = Exp<Method::Fourier, F, 50>(x, store.values()) -
+             Exp<Method::Fourier, F, 50>(x, samples);
+    std::cout << a_path << ": " << samples.size() << " samples, "
+              << sizeof(CoefFileHeader) + samples.size() * sizeof(F) << " bytes\n"
+              << "  compute " << ms(t1 - t0) << " ms, write " << ms(t2 - t1)
+              << " ms, map + verify " << ms(t3 - t2) << " ms\n"
+              << "  Exp(0.3) mapped - computed: " << diff << std::endl;
+    return diff == 0 ? 0 : 1;
+}
+
+int usage(const char *a_argv0) {
+    std::cerr << "usage: " << a_argv0
+              << " [--n N] [--type float|double|long-double] [--out FILE]" << std::endl;
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    size_t n = size_t(1) << 16;
+    std::string type = "double";
+    std::string out;
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--n") == 0 && has_value) {
+            n = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--type") == 0 && has_value) {
+            type = argv[++i];
+        } else if (std::strcmp(argv[i], "--out") == 0 && has_value) {
+            out = argv[++i];
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (n < 4 || n % 2 != 0) {
+        return usage(argv[0]);
+    }
+    if (out.empty()) {
+        out = "exp-fourier-" + type + "-" + std::to_string(n) + ".coef";
+    }
+
+    try {
+        if (type == "float") {
+            return run<float>(out, n);
+        } else if (type == "double") {
+            return run<double>(out, n);
+        } else if (type == "long-double") {
+            return run<long double>(out, n);
+        }
+    } catch (const std::runtime_error &e) {  // unwritable or unreadable file
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return usage(argv[0]);
+}
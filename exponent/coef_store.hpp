@@ -0,0 +1,269 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "exp.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ADAAI_HAVE_MMAP 1
+#else
+#define ADAAI_HAVE_MMAP 0
+#endif
+
+namespace ADAAI {
+
+// Versioned binary files of coefficient sets that are expensive to build (the
+// Fourier samples of Exp<Method::Fourier> for N = 2^16 and more). A file is
+// written once and mapped read-only by every process that needs it, so
+// workers share the page cache instead of each recomputing the set. Layout:
+//   CoefFileHeader (64 bytes) | N values of F in native byte order
+// Files are tied to the machine's floating-point format: the header's type
+// code (significand digits and maximum exponent) and value size reject
+// anything else, e.g. an x87 80-bit long double file read where long double is
+// binary128, though both are 16 bytes wide.
+
+enum class CoefMethod : uint32_t {
+    ChebyshevGauss = 1,  // chebyshevGaussQuadrature(N - 1)
+    FourierSamples = 2,  // fourierSamples(chebyshevGaussQuadrature(N - 1))
+};
+
+struct CoefFileHeader {
+    static constexpr char Magic[8] = {'A', 'D', 'A', 'A', 'I', 'C', 'F', '\0'};
+    static constexpr uint32_t Version = 2;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t type;  // CoefTypeCode<F>()
+    uint32_t value_size;  // sizeof(F)
+    uint32_t method;  // CoefMethod
+    uint64_t order;  // N the set was built for
+    uint64_t count;  // values that follow the header
+    uint64_t checksum;  // CoefChecksum of those values
+    uint8_t padding[16];
+};
+static_assert(sizeof(CoefFileHeader) == 64);
+
+// digits << 16 | max_exponent: 24 / 128 for binary32, 53 / 1024 for binary64,
+// 64 / 16384 for x87 extended, 113 / 16384 for binary128, 106 / 1024 for
+// double-double
+template <typename F>
+constexpr inline uint32_t CoefTypeCode() {
+    static_assert(std::is_floating_point_v<F>);
+    using L = std::numeric_limits<F>;
+    return (static_cast<uint32_t>(L::digits) << 16) |
+           static_cast<uint32_t>(L::max_exponent);
+}
+
+// 64-bit FNV-1a over the raw bytes
+inline uint64_t CoefChecksum(const void *a_data, size_t a_bytes) {
+    const auto *p = static_cast<const unsigned char *>(a_data);
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < a_bytes; ++i) {
+        h = (h ^ p[i]) * 1099511628211ull;
+    }
+    return h;
+}
+
+// writes a_values under a_path; the file appears atomically (written next to
+// it, then renamed), so concurrent readers see either nothing or all of it
+template <typename F>
+void writeCoefFile(
+    const std::string &a_path,
+    CoefMethod a_method,
+    uint64_t a_order,
+    std::span<const F> a_values
+) {
+    CoefFileHeader header = {};
+    std::memcpy(header.magic, CoefFileHeader::Magic, sizeof(header.magic));
+    header.version = CoefFileHeader::Version;
+    header.type = CoefTypeCode<F>();
+    header.value_size = sizeof(F);
+    header.method = static_cast<uint32_t>(a_method);
+    header.order = a_order;
+    header.count = a_values.size();
+    header.checksum = CoefChecksum(a_values.data(), a_values.size_bytes());
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(a_path).parent_path(), ec);
+#if ADAAI_HAVE_MMAP
+    const std::string tmp = a_path + ".tmp" + std::to_string(::getpid());
+#else
+    const std::string tmp = a_path + ".tmp";
+#endif
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(a_values.data()), a_values.size_bytes());
+        if (!out) {
+            std::filesystem::remove(tmp, ec);
+            throw std::runtime_error("coef store: cannot write " + tmp);
+        }
+    }
+    std::filesystem::rename(tmp, a_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        throw std::runtime_error("coef store: cannot rename to " + a_path);
+    }
+}
+
+// A read-only view of a coefficient file. The constructor maps the file and
+// checks the header against F and a_method (and, with a_verify, the checksum,
+// which touches every page once); a mismatch or an unreadable file throws
+// std::runtime_error. Move-only; the mapping lives as long as the object.
+template <typename F>
+class MappedCoefs {
+public:
+    MappedCoefs(const std::string &a_path, CoefMethod a_method, bool a_verify = true) {
+        map(a_path);
+        try {
+            check(a_path, a_method, a_verify);
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    MappedCoefs(MappedCoefs &&a_other) noexcept { swap(a_other); }
+
+    MappedCoefs &operator=(MappedCoefs &&a_other) noexcept {
+        if (this != &a_other) {
+            unmap();
+            swap(a_other);
+        }
+        return *this;
+    }
+
+    MappedCoefs(const MappedCoefs &) = delete;
+    MappedCoefs &operator=(const MappedCoefs &) = delete;
+
+    ~MappedCoefs() { unmap(); }
+
+    [[nodiscard]] std::span<const F> values() const { return m_values; }
+
+    [[nodiscard]] const CoefFileHeader &header() const {
+        return *static_cast<const CoefFileHeader *>(m_base);
+    }
+
+private:
+    const void *m_base = nullptr;
+    size_t m_bytes = 0;
+    std::vector<unsigned char> m_buffer;  // without mmap: the file read in
+    std::span<const F> m_values;
+
+    void swap(MappedCoefs &a_other) noexcept {
+        std::swap(m_base, a_other.m_base);
+        std::swap(m_bytes, a_other.m_bytes);
+        std::swap(m_buffer, a_other.m_buffer);
+        std::swap(m_values, a_other.m_values);
+    }
+
+    void map(const std::string &a_path) {
+#if ADAAI_HAVE_MMAP
+        int fd = ::open(a_path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("coef store: cannot open " + a_path);
+        }
+        struct stat st = {};
+        if (::fstat(fd, &st) != 0 || st.st_size < 0 ||
+            static_cast<size_t>(st.st_size) < sizeof(CoefFileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("coef store: truncated " + a_path);
+        }
+        m_bytes = static_cast<size_t>(st.st_size);
+        void *p = ::mmap(nullptr, m_bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // the mapping keeps the file alive
+        if (p == MAP_FAILED) {
+            m_bytes = 0;
+            throw std::runtime_error("coef store: cannot map " + a_path);
+        }
+        m_base = p;
+#else
+        std::ifstream in(a_path, std::ios::binary);
+        m_buffer.assign(std::istreambuf_iterator<char>(in), {});
+        if (!in && !in.eof()) {
+            throw std::runtime_error("coef store: cannot open " + a_path);
+        }
+        if (m_buffer.size() < sizeof(CoefFileHeader)) {
+            throw std::runtime_error("coef store: truncated " + a_path);
+        }
+        m_base = m_buffer.data();
+        m_bytes = m_buffer.size();
+#endif
+    }
+
+    void unmap() noexcept {
+#if ADAAI_HAVE_MMAP
+        if (m_base) {
+            ::munmap(const_cast<void *>(m_base), m_bytes);
+        }
+#endif
+        m_buffer.clear();
+        m_base = nullptr;
+        m_bytes = 0;
+        m_values = {};
+    }
+
+    void check(const std::string &a_path, CoefMethod a_method, bool a_verify) {
+        const CoefFileHeader &h = header();
+        auto fail = [&](const char *a_what) {
+            throw std::runtime_error(std::string("coef store: ") + a_what + " in " + a_path);
+        };
+        if (std::memcmp(h.magic, CoefFileHeader::Magic, sizeof(h.magic)) != 0) {
+            fail("bad magic");
+        }
+        if (h.version != CoefFileHeader::Version) {
+            fail("unsupported version");
+        }
+        if (h.type != CoefTypeCode<F>() || h.value_size != sizeof(F)) {
+            fail("value type mismatch");
+        }
+        if (h.method != static_cast<uint32_t>(a_method)) {
+            fail("method mismatch");
+        }
+        if (h.count > (m_bytes - sizeof(CoefFileHeader)) / sizeof(F)) {
+            fail("truncated data");
+        }
+        const auto *data = reinterpret_cast<const F *>(
+            static_cast<const unsigned char *>(m_base) + sizeof(CoefFileHeader)
+        );
+        m_values = {data, static_cast<size_t>(h.count)};
+        if (a_verify && CoefChecksum(data, m_values.size_bytes()) != h.checksum) {
+            fail("checksum mismatch");
+        }
+    }
+};
+
+// The Fourier samples for an N-term Chebyshev-Gauss set (N even), mapped from
+// a_path; a missing or invalid file is rebuilt and written first. Workers
+// started together may each rebuild it once; the rename keeps the file whole.
+template <typename F>
+MappedCoefs<F> fourierSampleStore(const std::string &a_path, size_t a_n) {
+    try {
+        MappedCoefs<F> store(a_path, CoefMethod::FourierSamples);
+        if (store.header().order == a_n) {
+            return store;
+        }
+    } catch (const std::runtime_error &) {
+        // fall through: (re)build the file
+    }
+    std::vector<F> coefs(a_n, 0);
+    chebyshevGaussQuadrature(static_cast<int>(a_n) - 1, coefs);
+    std::vector<F> samples = fourierSamples(coefs);
+    writeCoefFile<F>(a_path, CoefMethod::FourierSamples, a_n, samples);
+    return MappedCoefs<F>(a_path, CoefMethod::FourierSamples);
+}
+
+}  // namespace ADAAI
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <vector>
+#include "minimax_coef.hpp"
 
 namespace ADAAI {
 
@@ -58,6 +62,288 @@ constexpr inline F Ln2() {
     }
 }
 
+template <typename F>
+constexpr inline F Log2E() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return M_LOG2Ef;
+    }
+    if (std::is_same<F, double>::value) {
+        return M_LOG2E;
+    }
+    if (std::is_same<F, long double>::value) {
+        return M_LOG2El;
+    }
+}
+
+template <typename F>
+constexpr inline F TwoOverPi() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return 6.36619772E-1f;
+    }
+    if (std::is_same<F, double>::value) {
+        return 6.36619772367581343076E-1;
+    }
+    if (std::is_same<F, long double>::value) {
+        return 6.36619772367581343075535053490057448E-1L;
+    }
+}
+
+// three-part Cody-Waite split of pi / 2 for the sin / cos reduction: Hi and
+// Mid have enough trailing zero bits for k * Hi and k * Mid to be exact for
+// |k| < 2^12 (float), 2^20 (double, long double); Hi + Mid + Lo = pi / 2 to
+// about 2^-(2 * 12 + 24), 2^-(2 * 33 + 53), 2^-(2 * 44 + 64)
+template <typename F>
+constexpr inline F PiOver2Hi() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return 1.57080078125f;
+    }
+    if (std::is_same<F, double>::value) {
+        return 1.5707963267341256;
+    }
+    if (std::is_same<F, long double>::value) {
+        return 1.570796326794948072347324L;
+    }
+}
+
+template <typename F>
+constexpr inline F PiOver2Mid() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return -4.453584552E-6f;
+    }
+    if (std::is_same<F, double>::value) {
+        return 6.077100506303966E-11;
+    }
+    if (std::is_same<F, long double>::value) {
+        return -5.145311600265018620239260E-14L;
+    }
+}
+
+template <typename F>
+constexpr inline F PiOver2Lo() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return -8.705515753E-10f;
+    }
+    if (std::is_same<F, double>::value) {
+        return 2.0222662487959506E-21;
+    }
+    if (std::is_same<F, long double>::value) {
+        return 2.903855973979360333981635E-28L;
+    }
+}
+
+// |x| below which k = round(x * 2 / pi) stays within the limit of the split
+// above; SinCos reduces larger arguments by ReducePiOver2Large
+template <typename F>
+constexpr inline F PiOver2SplitMax() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return 4096.0f;
+    }
+    return 1048576.0;
+}
+
+// 2 / pi = 0.a2f9836e4e441529... (hexadecimal): the first 16640 bits after the
+// binary point, most significant word first, enough for the Payne-Hanek
+// reduction of any finite long double
+constexpr inline std::array<uint64_t, 260> TwoOverPiBits = {
+    0xa2f9836e4e441529ull, 0xfc2757d1f534ddc0ull, 0xdb6295993c439041ull,
+    0xfe5163abdebbc561ull, 0xb7246e3a424dd2e0ull, 0x06492eea09d1921cull,
+    0xfe1deb1cb129a73eull, 0xe88235f52ebb4484ull, 0xe99c7026b45f7e41ull,
+    0x3991d639835339f4ull, 0x9c845f8bbdf9283bull, 0x1ff897ffde05980full,
+    0xef2f118b5a0a6d1full, 0x6d367ecf27cb09b7ull, 0x4f463f669e5fea2dull,
+    0x7527bac7ebe5f17bull, 0x3d0739f78a5292eaull, 0x6bfb5fb11f8d5d08ull,
+    0x56033046fc7b6babull, 0xf0cfbc209af4361dull, 0xa9e391615ee61b08ull,
+    0x6599855f14a06840ull, 0x8dffd8804d732731ull, 0x06061556ca73a8c9ull,
+    0x60e27bc08c6b47c4ull, 0x19c367cddce8092aull, 0x8359c4768b961ca6ull,
+    0xddaf44d15719053eull, 0xa5ff07053f7e33e8ull, 0x32c2de4f98327dbbull,
+    0xc33d26ef6b1e5ef8ull, 0x9f3a1f35caf27f1dull, 0x87f121907c7c246aull,
+    0xfa6ed5772d30433bull, 0x15c614b59d19c3c2ull, 0xc4ad414d2c5d000cull,
+    0x467d862d71e39ac6ull, 0x9b0062337cd2b497ull, 0xa7b4d55537f63ed7ull,
+    0x1810a3fc764d2a9dull, 0x64abd770f87c6357ull, 0xb07ae715175649c0ull,
+    0xd9d63b3884a7cb23ull, 0x24778ad623545ab9ull, 0x1f001b0af1dfce19ull,
+    0xff319f6a1e666157ull, 0x9947fbacd87f7eb7ull, 0x652289e83260bfe6ull,
+    0xcdc4ef09366cd43full, 0x5dd7de16de3b5892ull, 0x9bde2822d2e88628ull,
+    0x4d58e232cac616e3ull, 0x08cb7de050c017a7ull, 0x1df35be01834132eull,
+    0x6212830148835b8eull, 0xf57fb0adf2e91e43ull, 0x4a48d36710d8ddaaull,
+    0x425faece616aa428ull, 0x0ab499d3f2a6067full, 0x775c83c2a3883c61ull,
+    0x78738a5a8cafbdd7ull, 0x6f63a62dcbbff4efull, 0x818d67c12645ca55ull,
+    0x36d9cad2a8288d61ull, 0xc277c9121426049bull, 0x4612c459c444c5c8ull,
+    0x91b24df31700ad43ull, 0xd4e5492910d5fdfcull, 0xbe00cc941eeece70ull,
+    0xf53e1380f1ecc3e7ull, 0xb328f8c79405933eull, 0x71c1b3092ef3450bull,
+    0x9c12887b20ab9fb5ull, 0x2ec292472f327b6dull, 0x550c90a7721fe76bull,
+    0x96cb314a1679e279ull, 0x4189dff49794e884ull, 0xe6e29731996bed88ull,
+    0x365f5f0efdbbb49aull, 0x486ca46742727132ull, 0x5d8db8159f09e5bcull,
+    0x25318d3974f71c05ull, 0x30010c0d68084b58ull, 0xee2c90aa4702e774ull,
+    0x24d6bda67df77248ull, 0x6eef169fa6948ef6ull, 0x91b45153d1f20acfull,
+    0x3398207e4bf56863ull, 0xb25f3edd035d407full, 0x8985295255c06437ull,
+    0x10d86d324832754cull, 0x5bd4714e6e5445c1ull, 0x090b69f52ad56614ull,
+    0x9d072750045ddb3bull, 0xb4c576ea17f9877dull, 0x6b49ba271d296996ull,
+    0xacccc65414ad6ae2ull, 0x9089d98850722cbeull, 0xa4049407777030f3ull,
+    0x27fc00a871ea49c2ull, 0x663de06483dd9797ull, 0x3fa3fd94438c860dull,
+    0xde41319d39928c70ull, 0xdde7b7173bdf082bull, 0x3715a0805c93805aull,
+    0x921110d8e80faf80ull, 0x6c4bffdb0f903876ull, 0x185915a562bbcb61ull,
+    0xb989c7bd401004f2ull, 0xd2277549f6b6ebbbull, 0x22dbaa140a2f2689ull,
+    0x768364333b091a94ull, 0x0eaa3a51c2a31daeull, 0xedaf12265c4dc26dull,
+    0x9c7a2d9756c0833full, 0x03f6f0098c402b99ull, 0x316d07b43915200cull,
+    0x5bc3d8c492f54badull, 0xc6a5ca4ecd37a736ull, 0xa9e69492ab6842ddull,
+    0xde6319ef8c76528bull, 0x6837dbfcaba1ae31ull, 0x15dfa1ae00dafb0cull,
+    0x664d64b705ed3065ull, 0x29bf56573aff47b9ull, 0xf96af3be75df9328ull,
+    0x3080abf68c6615cbull, 0x040622fa1de4d9a4ull, 0xb33d8f1b5709cd36ull,
+    0xe9424ea4be13b523ull, 0x331aaaf0a8654fa5ull, 0xc1d20f3f0bcd785bull,
+    0x76f923048b7b7217ull, 0x8953a6c6e26e6f00ull, 0xebef584a9bb7dac4ull,
+    0xba66aacfcf761d02ull, 0xd12df1b1c1998c77ull, 0xadc3da4886a05df7ull,
+    0xf480c62ff0ac9aecull, 0xddbc5c3f6dded01full, 0xc790b6db2a3a25a3ull,
+    0x9aaf009353ad0457ull, 0xb6b42d297e804ba7ull, 0x07da0eaa76a1597bull,
+    0x2a12162db7dcfde5ull, 0xfafedb89fdbe896cull, 0x76e4fca90670803eull,
+    0x156e85ff87fd073eull, 0x2833676186182aeaull, 0xbd4dafe7b36e6d8full,
+    0x3967955bbf3148d7ull, 0x8416df30432dc735ull, 0x6125ce70c9b8cb30ull,
+    0xfd6cbfa200a4e46cull, 0x05a0dd5a476f21d2ull, 0x1262845cb9496170ull,
+    0xe0566b0152993755ull, 0x50b7d51ec4f1335full, 0x6e13e4305da92e85ull,
+    0xc3b21d3632a1a4b7ull, 0x08d4b1ea21f716e4ull, 0x698f77ff2780030cull,
+    0x2d408da0cd4f99a5ull, 0x20d3a2b30a5d2f42ull, 0xf9b4cbda11d0be7dull,
+    0xc1db9bbd17ab81a2ull, 0xca5c6a0817552e55ull, 0x0027f0147f8607e1ull,
+    0x640b148d4196debeull, 0x872afddab6256b34ull, 0x897bfef3059ebfb9ull,
+    0x4f6a68a82a4a5ac4ull, 0x4fbcf82d985ad795ull, 0xc7f48d4d0da63a20ull,
+    0x5f57a4b13f149538ull, 0x800120cc86dd71b6ull, 0xdec9f560bf11654dull,
+    0x6b0701acb08cd0c0ull, 0xb24855510efb1ec3ull, 0x72953b06a33540c0ull,
+    0x7bdc06cc45e0fa29ull, 0x4ec8cad641f3e8deull, 0x647cd8649b31bed9ull,
+    0xc397a4d45877c5e3ull, 0x6913daf03c3aba46ull, 0x18465f7555f5bdd2ull,
+    0xc6926e5d2eaced44ull, 0x0e423e1c87c461e9ull, 0xfd29f3d6e7ca7c22ull,
+    0x35916fc5e0088dd7ull, 0xffe26a6ec6fdb0c1ull, 0x0893745d7cb2ad6bull,
+    0x9d6ecd7b723e6a11ull, 0xc6a9cff7df7329baull, 0xc9b55100b70db2e2ull,
+    0x24ba74607de58ad8ull, 0x742c150d0c188194ull, 0x667e162901767a9full,
+    0xbefdfdef4556367eull, 0xd913d9ecb9ba8bfcull, 0x97c427a831c36ef1ull,
+    0x36c59456a8d8b5a8ull, 0xb40ecccf2d891234ull, 0x576f89562ce3ce99ull,
+    0xb920d6aa5e6b9c2aull, 0x3ecc5f114a0bfdfbull, 0xf4e16d3b8e2c86e2ull,
+    0x84d4e9a9b4fcd1eeull, 0xefc9352e61392f44ull, 0x2138c8d91b0afc81ull,
+    0x6a4afbd81c2f84b4ull, 0x538c994ecc2254dcull, 0x552ad6c6c096190bull,
+    0xb8701a649569605aull, 0x26ee523f0f117f11ull, 0xb5f4f5cbfc2dbc34ull,
+    0xeebc34cc5de8605eull, 0xdd9b8e67ef3392b8ull, 0x17c99b5861bc57e1ull,
+    0xc68351103ed84871ull, 0xdddd1c2da118af46ull, 0x2c21d7f359987ad9ull,
+    0xc0549efa864ffc06ull, 0x56ae79e536228922ull, 0xad38dc9367aae855ull,
+    0x3826829be7caa40dull, 0x51b133990ed7a948ull, 0x0569f0b265a7887full,
+    0x974c8836d1f9b392ull, 0x214a827b21cf98dcull, 0x9f405547dc3a74e1ull,
+    0x42eb67df9dfe5fd4ull, 0x5ea4677b7aacbaa2ull, 0xf65523882b55ba41ull,
+    0x086e59862a218347ull, 0x39e6e389d49ee540ull, 0xfb49e956ffca0f1cull,
+    0x8a59c52bfa94c5c1ull, 0xd3cfc50fae5adb86ull, 0xc5476243853b8621ull,
+    0x94792c8761107b4cull, 0x2a1a2c8012bf4390ull, 0x2688893c78e4c4a8ull,
+    0x7bdbe5c23ac4eaf4ull, 0x268a67f7bf920d2bull, 0xa365b1933d0b7cbdull,
+    0xdc51a463dd27dde1ull, 0x6919949a9529a828ull, 0xce68b4ed09209f44ull,
+    0xca984e638270237cull, 0x7e32b90f8ef5a7e7ull, 0x561408f1212a9db5ull,
+    0x4d7e6f5119a5abf9ull, 0xb5d6df8261dd9602ull, 0x36169f3ac4a1a283ull,
+    0x6ded727a8d39a9b8ull, 0x825c326b5b2746edull, 0x34007700d255f4fcull,
+    0x4d59018071e0e13full, 0x89b295f364a8f1aeull
+};
+
+// exp(x) is +inf above ExpMax<F>() and rounds to 0 below ExpMin<F>()
+template <typename F>
+constexpr inline F ExpMax() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return 89.0f;
+    }
+    if (std::is_same<F, double>::value) {
+        return 710.0;
+    }
+    if (std::is_same<F, long double>::value) {
+        return 11357.0L;
+    }
+}
+
+template <typename F>
+constexpr inline F ExpMin() {
+    static_assert(std::is_floating_point_v<F>);
+    if (std::is_same<F, float>::value) {
+        return -104.0f;
+    }
+    if (std::is_same<F, double>::value) {
+        return -746.0;
+    }
+    if (std::is_same<F, long double>::value) {
+        return -11400.0L;
+    }
+}
+
+// ln2 = 0.b17217f7d1cf79ab... (hexadecimal): the first 256 bits after the
+// binary point, most significant word first
+constexpr inline std::array<uint64_t, 4> Ln2Bits = {
+    0xb17217f7d1cf79abull, 0xc9e3b39803f2f6afull, 0x40f343267298b62dull,
+    0x8a0d175b8baafa2bull
+};
+
+// bits a_pos .. a_pos + a_count - 1 of Ln2Bits (bit 0 weighs 2^-1) as an
+// integer, a_count <= 64
+constexpr inline uint64_t Ln2BitRange(int a_pos, int a_count) {
+    uint64_t res = 0;
+    for (int b = a_pos; b < a_pos + a_count; ++b) {
+        uint64_t bit = b < 256 ? (Ln2Bits[b / 64] >> (63 - b % 64)) & 1 : 0;
+        res = res << 1 | bit;
+    }
+    return res;
+}
+
+// bits of the largest |n| in x = n * ln2 + r over [ExpMin, ExpMax]; it also
+// covers the binary exponents Log splits off, subnormals included
+template <typename F>
+constexpr inline int Ln2SplitBits() {
+    long double x = std::max<long double>(ExpMax<F>(), -ExpMin<F>());
+    long double n = x * Log2E<long double>() + 1;
+    int bits = 0;
+    for (; static_cast<long double>(uint64_t(1) << bits) <= n; bits++) {
+    }
+    return bits;
+}
+
+// Cody-Waite split of ln2 into Parts values of F, generated from Ln2Bits.
+// Every part but the last keeps digits - Ln2SplitBits<F>() significant bits,
+// so n times it is exact for every n a reduction produces; the last part has
+// full precision. All parts are truncations, so the sum is ln2 to within one
+// unit of the last part's last bit.
+template <typename F, int Parts>
+constexpr std::array<F, Parts> makeLn2Parts() {
+    constexpr int Digits = std::numeric_limits<F>::digits;
+    constexpr int Short = Digits - Ln2SplitBits<F>();
+    static_assert(Parts >= 1 && Digits <= 64);
+
+    std::array<F, Parts> parts = {};
+    int pos = 0;  // the first bit not taken yet
+    for (int p = 0; p < Parts; ++p) {
+        while (Ln2BitRange(pos, 1) == 0) {
+            pos++;
+        }
+        int count = p + 1 < Parts ? Short : Digits;
+        F part = static_cast<F>(Ln2BitRange(pos, count));  // exact
+        for (int i = 0; i < pos + count; ++i) {
+            part /= 2;  // exact
+        }
+        parts[p] = part;
+        pos += count;
+    }
+    return parts;
+}
+
+template <typename F, int Parts>
+constexpr inline std::array<F, Parts> Ln2Parts = makeLn2Parts<F, Parts>();
+
+// the two-part split Ln2<F>() = Ln2Hi<F>() + Ln2Lo<F>(): n * Ln2Hi<F>() is
+// exact for every n the reduction of a finite exp argument can produce
+template <typename F>
+constexpr inline F Ln2Hi() {
+    static_assert(std::is_floating_point_v<F>);
+    return Ln2Parts<F, 2>[0];
+}
+
+template <typename F>
+constexpr inline F Ln2Lo() {
+    static_assert(std::is_floating_point_v<F>);
+    return Ln2Parts<F, 2>[1];
+}
+
 template <typename F>
 constexpr inline F Sqrt2() {
     static_assert(std::is_floating_point_v<F>);
@@ -75,16 +361,185 @@ constexpr inline F Sqrt2() {
 template <typename F>
 constexpr inline F Eps = std::numeric_limits<F>::epsilon();
 
+// std::abs is not required to be constexpr before C++23
 template <typename F>
-constexpr inline int MKExpTaylorOrder() {
-    F a_atol = 10.0 * Eps<F>;
+constexpr inline F Abs(F a_x) {
+    return a_x < 0 ? -a_x : a_x;
+}
+
+// lowest order N for which the Taylor remainder of exp on |x| <= ln2 / 2 stays
+// below a_atol; the default is what Exp targets without a tolerance
+template <typename F>
+constexpr inline int MKExpTaylorOrder(long double a_atol = 10 * Eps<F>) {
     F arg = Ln2<F>() / 2;
     F rem = Sqrt2<F>() * arg;
     int k = 1;
-    for (; std::abs(rem) > a_atol; k++) {
+    for (; Abs(rem) > a_atol; k++) {
         rem *= arg / (k + 1);
     }
     return k - 1;
 }
 
+// Method::Table splits the reduced argument into k * ln2 / 2^ExpTableBits + r
+constexpr inline int ExpTableBits = 6;
+
+// lowest order N for which the Taylor remainder of exp(r) - 1 on
+// |r| <= ln2 / 2^(ExpTableBits + 1) stays below a_atol
+template <typename F>
+constexpr inline int MKExpTableOrder(long double a_atol = Eps<F> / 2) {
+    F arg = Ln2<F>() / (2 << ExpTableBits);
+    F rem = arg;
+    int k = 1;
+    for (; Abs(rem) > a_atol; k++) {
+        rem *= arg / (k + 1);
+    }
+    return k - 1;
+}
+
+// Taylor coefficients of exp: 1 / k!, k = 0..N
+template <typename F, int N>
+constexpr inline std::array<F, N + 1> ExpTaylorCoef() {
+    std::array<F, N + 1> coef = {1.0};
+    for (int k = 1; k <= N; k++) {
+        coef[k] = coef[k - 1] / k;
+    }
+    return coef;
+}
+
+// ln2^k / k!, k = 0..N: 2^f = exp(f * ln2) without the multiplication by ln2
+template <typename F, int N>
+constexpr inline std::array<F, N + 1> Exp2TaylorCoef() {
+    std::array<F, N + 1> coef = {};
+    long double c = 1;
+    for (int k = 0; k <= N; k++) {
+        coef[k] = static_cast<F>(c);
+        c *= Ln2<long double>() / (k + 1);
+    }
+    return coef;
+}
+
+// lowest order N for which the Taylor remainder of exp(r) - 1 on
+// |r| <= ln2 / 2 stays below a_rtol relative to exp(r) - 1 itself: with
+// e^|r| <= sqrt(2) and |exp(r) - 1| >= |r| / sqrt(2) the bound is
+// 2 |r|^N / (N + 1)!. MKExpTaylorOrder bounds the error on exp(r) instead,
+// which near |r| = ln2 / 2 leaves several ulp of exp(r) - 1.
+template <typename F>
+constexpr inline int MKExpm1TaylorOrder(long double a_rtol = Eps<F> / 2) {
+    F arg = Ln2<F>() / 2;
+    F rem = arg;  // N = 1
+    int k = 1;
+    for (; Abs(rem) > a_rtol; k++) {
+        rem *= arg / (k + 2);
+    }
+    return k;
+}
+
+// 1 / (k + 1)!, k = 0..N - 1: exp(r) - 1 = r * sum_k c_k r^k to order N
+template <typename F, int N>
+constexpr inline std::array<F, N> Expm1TaylorCoef() {
+    std::array<F, N> coef = {1.0};
+    for (int k = 1; k < N; k++) {
+        coef[k] = coef[k - 1] / (k + 1);
+    }
+    return coef;
+}
+
+// lowest order N for which the Taylor remainders of sin and cos on
+// |r| <= pi / 4 stay below a_atol
+template <typename F>
+constexpr inline int MKSinCosOrder(long double a_atol = Eps<F> / 2) {
+    F arg = PI<F>() / 4;
+    F rem = arg;
+    int k = 1;
+    for (; Abs(rem) > a_atol; k++) {
+        rem *= arg / (k + 1);
+    }
+    return k - 1;
+}
+
+// (-1)^j / (2j + 1)!, j = 0..K: sin(r) = r * sum_j c_j r^(2j)
+template <typename F, int K>
+constexpr inline std::array<F, K + 1> SinTaylorCoef() {
+    std::array<F, K + 1> coef = {1.0};
+    for (int j = 1; j <= K; j++) {
+        coef[j] = -coef[j - 1] / ((2 * j) * (2 * j + 1));
+    }
+    return coef;
+}
+
+// (-1)^j / (2j)!, j = 0..K: cos(r) = sum_j c_j r^(2j)
+template <typename F, int K>
+constexpr inline std::array<F, K + 1> CosTaylorCoef() {
+    std::array<F, K + 1> coef = {1.0};
+    for (int j = 1; j <= K; j++) {
+        coef[j] = -coef[j - 1] / ((2 * j - 1) * (2 * j));
+    }
+    return coef;
+}
+
+// log(m) = 2 atanh(s) = 2s * sum_j s^(2j) / (2j + 1), s = (m - 1) / (m + 1);
+// for m in [sqrt(1/2), sqrt(2)) |s| <= 3 - 2 sqrt(2). Lowest K for which the
+// relative remainder past s^(2K) stays below a_rtol.
+template <typename F>
+constexpr inline int MKLogOrder(long double a_rtol = Eps<F> / 2) {
+    F s = 3 - 2 * Sqrt2<F>();
+    F rem = s * s / 3;
+    int k = 1;
+    for (; rem > a_rtol; k++) {
+        rem *= s * s * (2 * k + 1) / (2 * k + 3);
+    }
+    return k - 1;
+}
+
+// 1 / (2j + 1), j = 0..K
+template <typename F, int K>
+constexpr inline std::array<F, K + 1> LogAtanhCoef() {
+    std::array<F, K + 1> coef = {};
+    for (int j = 0; j <= K; j++) {
+        coef[j] = static_cast<F>(1) / (2 * j + 1);
+    }
+    return coef;
+}
+
+// 1 / k! as double-double pairs {hi, lo}: hi is 1 / k! rounded to double, lo
+// the rounded remainder
+constexpr inline std::array<std::array<double, 2>, 12> InvFactorialDD = {{
+    {1.0, 0.0},
+    {1.0, 0.0},
+    {0.5, 0.0},
+    {1.6666666666666666E-1, 9.25185853854297E-18},
+    {4.1666666666666664E-2, 2.3129646346357427E-18},
+    {8.333333333333333E-3, 1.1564823173178714E-19},
+    {1.388888888888889E-3, -5.300543954373577E-20},
+    {1.984126984126984E-4, 1.7209558293420705E-22},
+    {2.48015873015873E-5, 2.1511947866775882E-23},
+    {2.7557319223985893E-6, -1.858393274046472E-22},
+    {2.755731922398589E-7, 2.3767714622250297E-23},
+    {2.505210838544172E-8, -1.448814070935912E-24},
+}};
+
+// lowest degree of the minimax polynomial of exp on [-ln2/2, ln2/2] whose
+// relative error (minimax_coef.hpp) does not exceed a_rtol; the default, a
+// quarter of the machine epsilon, leaves room for the rounding of the
+// coefficients and of the evaluation
+template <typename F>
+constexpr inline int MKExpMinimaxOrder(long double a_rtol = Eps<F> / 4) {
+    int d = 1;
+    while (d < MinimaxExpTable<F>::MaxDegree && MinimaxExpTable<F>::Error[d] > a_rtol) {
+        d++;
+    }
+    return d;
+}
+
+// coefficients of the minimax polynomial of degree D, lowest power first
+template <typename F, int D>
+constexpr inline std::array<F, D + 1> ExpMinimaxCoef() {
+    static_assert(0 < D && D <= MinimaxExpTable<F>::MaxDegree);
+    std::array<F, D + 1> coef = {};
+    for (int k = 0; k <= D; k++) {
+        coef[k] = MinimaxExpTable<F>::Coef[D][k];
+    }
+    return coef;
+}
+
 }  // namespace ADAAI
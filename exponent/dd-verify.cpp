@@ -0,0 +1,153 @@
+// Accuracy and speed of the double-double ExpDD / ExpDDN (dd.hpp) against the
+// software __float128 expq of libquadmath:
+//
+//   ./dd-verify [--n N] [--range R] [--repeats K]
+//
+// Inputs are x_hi + x_lo with x_hi uniform in [-R, R] and x_lo a random
+// fraction of ulp(x_hi) / 2; the error is |y - expq(x)| / expq(x) in units of
+// 2^-106, the precision of a double-double. Below 2^-969 the lo part is
+// subnormal and a double-double degrades towards a double; such results are
+// counted, not included in the error.
+
+#include <quadmath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+#include "dd.hpp"
+
+using namespace ADAAI;
+
+namespace {
+
+struct Options {
+    size_t n = 1 << 16;
+    double range = 700;
+    int repeats = 5;
+};
+
+struct Error {
+    double max = 0;
+    double mean = 0;
+    double worst_x = 0;
+    size_t tiny = 0;  // results below 2^-969, not included
+};
+
+Error relativeError(
+    const std::vector<double> &a_xh,
+    const std::vector<double> &a_xl,
+    const std::vector<double> &a_yh,
+    const std::vector<double> &a_yl
+) {
+    const __float128 unit = ldexpq(1, -106);
+    const __float128 tiny = ldexpq(1, -969);
+    Error err;
+    for (size_t i = 0; i < a_xh.size(); ++i) {
+        __float128 ref = expq(static_cast<__float128>(a_xh[i]) + a_xl[i]);
+        if (ref < tiny) {
+            err.tiny++;
+            continue;
+        }
+        __float128 y = static_cast<__float128>(a_yh[i]) + a_yl[i];
+        double e = static_cast<double>(fabsq(y - ref) / ref / unit);
+        if (e > err.max) {
+            err.max = e, err.worst_x = a_xh[i];
+        }
+        err.mean += e;
+    }
+    err.mean /= static_cast<double>(std::max<size_t>(a_xh.size() - err.tiny, 1));
+    return err;
+}
+
+void report(const char *a_name, const bench::Timing &a_time, const Error *a_err) {
+    std::cout << std::left << std::setw(12) << a_name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << a_time.ns << " ns"
+              << std::setw(10) << a_time.cycles << " cycles";
+    if (a_err) {
+        std::cout << std::setprecision(2) << "   max " << a_err->max << ", mean "
+                  << a_err->mean << " x 2^-106 (worst at x = "
+                  << std::setprecision(17) << a_err->worst_x << ", " << a_err->tiny
+                  << " below 2^-969)";
+    }
+    std::cout << std::endl;
+}
+
+int usage(const char *a_argv0) {
+    std::cerr << "usage: " << a_argv0 << " [--n N] [--range R] [--repeats K]"
+              << std::endl;
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--n") == 0 && has_value) {
+            opt.n = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--range") == 0 && has_value) {
+            opt.range = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--repeats") == 0 && has_value) {
+            opt.repeats = std::atoi(argv[++i]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (opt.n == 0 || opt.repeats < 1) {
+        return usage(argv[0]);
+    }
+
+    std::mt19937_64 gen(2024);
+    std::uniform_real_distribution<double> dist(-opt.range, opt.range);
+    std::uniform_real_distribution<double> frac(-0.5, 0.5);
+    std::vector<double> xh(opt.n), xl(opt.n), yh(opt.n), yl(opt.n);
+    std::vector<__float128> yq(opt.n);
+    for (size_t i = 0; i < opt.n; ++i) {
+        xh[i] = dist(gen);
+        xl[i] = frac(gen) * (std::nextafter(std::abs(xh[i]), INFINITY) - std::abs(xh[i]));
+    }
+
+    auto quad = bench::measure(
+        [&] {
+            for (size_t i = 0; i < opt.n; ++i) {
+                yq[i] = expq(static_cast<__float128>(xh[i]) + xl[i]);
+            }
+            bench::doNotOptimize(yq.data());
+        },
+        opt.n, opt.repeats
+    );
+    report("expq", quad, nullptr);
+
+    auto scalar = bench::measure(
+        [&] {
+            for (size_t i = 0; i < opt.n; ++i) {
+                DoubleDouble y = ExpDD({xh[i], xl[i]});
+                yh[i] = y.hi, yl[i] = y.lo;
+            }
+            bench::doNotOptimize(yh.data());
+        },
+        opt.n, opt.repeats
+    );
+    Error scalar_err = relativeError(xh, xl, yh, yl);
+    report("ExpDD", scalar, &scalar_err);
+
+    auto batch = bench::measure(
+        [&] {
+            ExpDDN(xh, xl, yh, yl);
+            bench::doNotOptimize(yh.data());
+        },
+        opt.n, opt.repeats
+    );
+    Error batch_err = relativeError(xh, xl, yh, yl);
+    report("ExpDDN", batch, &batch_err);
+
+    std::cout << std::setprecision(1) << "speed-up over expq: " << quad.ns / scalar.ns
+              << "x scalar, " << quad.ns / batch.ns << "x batch" << std::endl;
+    return 0;
+}
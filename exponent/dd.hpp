@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include "simd.hpp"
+
+namespace ADAAI {
+
+// Double-double exponential for reference computations that need more than
+// the 64 bits of long double: a value is the unevaluated sum hi + lo of two
+// doubles, |lo| <= ulp(hi) / 2, about 106 bits of mantissa. The kernel
+// (simd_kernels.inc, Kernels::expDD) is built from the error-free
+// transformations of eft.hpp and is accurate to about 2^-104 relative for
+// normal results, at a fraction of the cost of the software __float128 expq.
+
+struct DoubleDouble {
+    double hi = 0;
+    double lo = 0;
+};
+
+// exp(a_x.hi + a_x.lo) on the scalar instantiation of the kernel
+inline DoubleDouble ExpDD(DoubleDouble a_x) {
+    auto y = simd::scalar::Kernels::expDD({a_x.hi, a_x.lo});
+    return {y.hi, y.lo};
+}
+
+inline DoubleDouble ExpDD(double a_x) {
+    return ExpDD(DoubleDouble{a_x, 0});
+}
+
+// out_hi[i] + out_lo[i] = exp(in_hi[i] + in_lo[i]), with the hi and lo parts
+// in separate arrays so that every lane loads and stores whole registers; an
+// empty in_lo stands for zeros. Dispatched like ExpN.
+inline void ExpDDN(
+    std::span<const double> in_hi,
+    std::span<const double> in_lo,
+    std::span<double> out_hi,
+    std::span<double> out_lo,
+    simd::Isa isa = simd::detectIsa()
+) {
+    assert(in_lo.empty() || in_lo.size() >= in_hi.size());
+    assert(out_hi.size() >= in_hi.size() && out_lo.size() >= in_hi.size());
+
+    const double *xh = in_hi.data();
+    const double *xl = in_lo.empty() ? nullptr : in_lo.data();
+    double *yh = out_hi.data();
+    double *yl = out_lo.data();
+    const size_t n = in_hi.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::expDDArray(xh, xl, yh, yl, n);
+    });
+    simd::scalar::Kernels::expDDArray(
+        xh + done, xl ? xl + done : nullptr, yh + done, yl + done, n - done
+    );
+}
+
+}  // namespace ADAAI
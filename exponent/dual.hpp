@@ -0,0 +1,208 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include "exp.hpp"
+#include "exp_simd.hpp"
+
+namespace ADAAI {
+
+// Forward-mode dual numbers over N independent variables: Dual carries the
+// value and the gradient, Dual2 also the Hessian, packed as its upper triangle
+// row by row (hess[Dual2::index(i, j)], i <= j). Since exp' = exp, Exp on
+// them runs the reduction and polynomial of the scalar Exp once and scales
+// every tangent component by the result.
+
+template <typename F, size_t N>
+struct Dual {
+    F val = 0;
+    std::array<F, N> grad = {};
+
+    // the variable number a_i with value a_val
+    static constexpr Dual variable(F a_val, size_t a_i) {
+        Dual res{a_val};
+        res.grad[a_i] = 1;
+        return res;
+    }
+
+    constexpr Dual operator-() const {
+        Dual res{-val};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = -grad[i];
+        }
+        return res;
+    }
+
+    constexpr Dual operator+(const Dual &other) const {
+        Dual res{val + other.val};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] + other.grad[i];
+        }
+        return res;
+    }
+
+    constexpr Dual operator-(const Dual &other) const { return *this + (-other); }
+
+    constexpr Dual operator*(const Dual &other) const {
+        Dual res{val * other.val};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] * other.val + val * other.grad[i];
+        }
+        return res;
+    }
+
+    constexpr Dual operator+(F a_c) const {
+        Dual res = *this;
+        res.val += a_c;
+        return res;
+    }
+
+    constexpr Dual operator*(F a_c) const {
+        Dual res{val * a_c};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] * a_c;
+        }
+        return res;
+    }
+};
+
+template <typename F, size_t N>
+struct Dual2 {
+    static constexpr size_t Packed = N * (N + 1) / 2;
+
+    F val = 0;
+    std::array<F, N> grad = {};
+    std::array<F, Packed> hess = {};
+
+    // position of d2 / dx_i dx_j in hess, i <= j
+    static constexpr size_t index(size_t i, size_t j) {
+        return i * N - i * (i + 1) / 2 + j;
+    }
+
+    static constexpr Dual2 variable(F a_val, size_t a_i) {
+        Dual2 res{a_val};
+        res.grad[a_i] = 1;
+        return res;
+    }
+
+    constexpr Dual2 operator-() const { return *this * static_cast<F>(-1); }
+
+    constexpr Dual2 operator+(const Dual2 &other) const {
+        Dual2 res{val + other.val};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] + other.grad[i];
+        }
+        for (size_t k = 0; k < Packed; ++k) {
+            res.hess[k] = hess[k] + other.hess[k];
+        }
+        return res;
+    }
+
+    constexpr Dual2 operator-(const Dual2 &other) const { return *this + (-other); }
+
+    constexpr Dual2 operator*(const Dual2 &other) const {
+        Dual2 res{val * other.val};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] * other.val + val * other.grad[i];
+            for (size_t j = i; j < N; ++j) {
+                size_t k = index(i, j);
+                res.hess[k] = hess[k] * other.val + val * other.hess[k] +
+                              grad[i] * other.grad[j] + grad[j] * other.grad[i];
+            }
+        }
+        return res;
+    }
+
+    constexpr Dual2 operator+(F a_c) const {
+        Dual2 res = *this;
+        res.val += a_c;
+        return res;
+    }
+
+    constexpr Dual2 operator*(F a_c) const {
+        Dual2 res{val * a_c};
+        for (size_t i = 0; i < N; ++i) {
+            res.grad[i] = grad[i] * a_c;
+        }
+        for (size_t k = 0; k < Packed; ++k) {
+            res.hess[k] = hess[k] * a_c;
+        }
+        return res;
+    }
+};
+
+// e = exp(x) once, then grad -> e * grad
+template <
+    Method M = Method::Pade,
+    typename F,
+    size_t Capacity,
+    Scheme S = Scheme::Horner,
+    Reduction R = Reduction::Modf,
+    long double Tol = 0.0L,
+    size_t N>
+constexpr Dual<F, N> Exp(const Dual<F, N> &a_x) noexcept {
+    Dual<F, N> res{Exp<M, F, Capacity, S, R, Tol>(a_x.val)};
+    for (size_t i = 0; i < N; ++i) {
+        res.grad[i] = res.val * a_x.grad[i];
+    }
+    return res;
+}
+
+// e = exp(x) once, then grad -> e * grad, hess_ij -> e * (hess_ij + g_i g_j)
+template <
+    Method M = Method::Pade,
+    typename F,
+    size_t Capacity,
+    Scheme S = Scheme::Horner,
+    Reduction R = Reduction::Modf,
+    long double Tol = 0.0L,
+    size_t N>
+constexpr Dual2<F, N> Exp(const Dual2<F, N> &a_x) noexcept {
+    Dual2<F, N> res{Exp<M, F, Capacity, S, R, Tol>(a_x.val)};
+    for (size_t i = 0; i < N; ++i) {
+        res.grad[i] = res.val * a_x.grad[i];
+        for (size_t j = i; j < N; ++j) {
+            size_t k = Dual2<F, N>::index(i, j);
+            res.hess[k] = res.val * (a_x.hess[k] + a_x.grad[i] * a_x.grad[j]);
+        }
+    }
+    return res;
+}
+
+// out[i] = exp(in[i]) for arrays of Dual or Dual2 (float / double): the values
+// go through the vector kernel of ExpN a block at a time, then the tangents of
+// each element are scaled by its exponential; out may alias in
+template <typename D>
+void ExpDualN(std::span<const D> in, std::span<D> out, simd::Isa isa = simd::detectIsa()) {
+    using F = decltype(D::val);
+    assert(out.size() >= in.size());
+
+    constexpr size_t Block = 256;
+    F x[Block], e[Block];
+    for (size_t begin = 0; begin < in.size(); begin += Block) {
+        size_t n = std::min(Block, in.size() - begin);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = in[begin + i].val;
+        }
+        ExpN<F>({x, n}, {e, n}, isa);
+        for (size_t i = 0; i < n; ++i) {
+            const D &a = in[begin + i];
+            D res = {e[i]};
+            for (size_t g = 0; g < a.grad.size(); ++g) {
+                res.grad[g] = e[i] * a.grad[g];
+            }
+            if constexpr (requires { a.hess; }) {
+                for (size_t p = 0; p < a.grad.size(); ++p) {
+                    for (size_t q = p; q < a.grad.size(); ++q) {
+                        size_t k = D::index(p, q);
+                        res.hess[k] = e[i] * (a.hess[k] + a.grad[p] * a.grad[q]);
+                    }
+                }
+            }
+            out[begin + i] = res;
+        }
+    }
+}
+
+}  // namespace ADAAI
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace ADAAI {
+
+// Error-free transformations: a op b == first + second exactly, where first is
+// the rounded result and second the rounding error
+
+// Knuth's TwoSum, no condition on |a| and |b|
+template <typename F>
+constexpr std::pair<F, F> TwoSum(F a, F b) {
+    F s = a + b;
+    F bb = s - a;
+    F e = (a - (s - bb)) + (b - bb);
+    return {s, e};
+}
+
+// Veltkamp split a = hi + lo, both halves fit into half of the mantissa
+template <typename F>
+constexpr std::pair<F, F> Split(F a) {
+    constexpr int shift = (std::numeric_limits<F>::digits + 1) / 2;
+    constexpr F factor = static_cast<F>((1ull << shift) + 1);
+    F c = factor * a;
+    F hi = c - (c - a);
+    return {hi, a - hi};
+}
+
+// a single FMA where the hardware has one for F, Dekker's product otherwise
+// and during constant evaluation (std::fma is constexpr only since C++23)
+template <typename F>
+constexpr std::pair<F, F> TwoProd(F a, F b) {
+    F p = a * b;
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+    if (!std::is_constant_evaluated() && !std::is_same_v<F, long double>) {
+        return {p, std::fma(a, b, -p)};
+    }
+#endif
+    auto [ah, al] = Split(a);
+    auto [bh, bl] = Split(b);
+    F e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+    return {p, e};
+}
+
+// c - a * b, rounded once where the hardware has an FMA for F (as TwoProd)
+template <typename F>
+constexpr F Fnma(F a, F b, F c) {
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+    if (!std::is_constant_evaluated() && !std::is_same_v<F, long double>) {
+        return std::fma(-a, b, c);
+    }
+#endif
+    return c - a * b;
+}
+
+}  // namespace ADAAI
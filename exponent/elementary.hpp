@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "constants.hpp"
+#include "poly.hpp"
+#include "reduction.hpp"
+
+namespace ADAAI {
+
+// Scalar exp2, expm1, log and sin / cos on the reduction of Exp (Cody-Waite
+// splits of ln2 and pi / 2, magic-constant rounding, ScalePow2) and its
+// polynomial evaluation (evalPoly). As in Exp, Tol > 0 is the accuracy to aim
+// for and lowers the polynomial orders; Tol == 0 keeps the defaults. The
+// float / double array forms are in exp_simd.hpp.
+
+// 2^x: x = n + f with |f| <= 1/2, 2^f = exp(f * ln2) by the Taylor polynomial
+// of Exp with the powers of ln2 folded into the coefficients
+template <typename F, long double Tol = 0.0L>
+constexpr F Exp2(F a_x) noexcept {
+    static_assert(std::is_floating_point_v<F>);
+    if (a_x != a_x)
+        return a_x;
+    if (a_x > ExpMax<F>() * Log2E<F>())
+        return std::numeric_limits<F>::infinity();
+    else if (a_x < ExpMin<F>() * Log2E<F>())
+        return 0.0;
+
+    constexpr int N = Tol > 0 ? MKExpTaylorOrder<F>(Tol) : MKExpTaylorOrder<F>();
+    F n = (a_x + RoundMagic<F>()) - RoundMagic<F>();
+    F f = a_x - n;  // exact
+    return ScalePow2(evalPoly(Exp2TaylorCoef<F, N>(), f), static_cast<int>(n));
+}
+
+// exp(x) - 1 without the cancellation near 0: with x = n * ln2 + r,
+// exp(x) - 1 = 2^n * expm1(r) + (2^n - 1), where expm1(r) = r * p(r) keeps
+// the relative accuracy of r and 2^n - 1 is exact for the n that matter. Past
+// n = digits + 1 the -1 is below half an ulp and 2^n * (expm1(r) + 1) is
+// scaled in two steps by ScalePow2, as in Exp, so that 2^n itself may
+// overflow.
+template <typename F, long double Tol = 0.0L>
+constexpr F Expm1(F a_x) noexcept {
+    static_assert(std::is_floating_point_v<F>);
+    if (a_x != a_x)
+        return a_x;
+    if (a_x > ExpMax<F>())
+        return std::numeric_limits<F>::infinity();
+    else if (a_x < ExpMin<F>())
+        return -1.0;
+
+    constexpr int N = Tol > 0 ? MKExpm1TaylorOrder<F>(Tol) : MKExpm1TaylorOrder<F>();
+    Reduced<F> red = ReduceCodyWaite<F>(a_x);
+    F q = red.r * evalPoly(Expm1TaylorCoef<F, N>(), red.r);
+    if (red.n == 0)
+        return q;
+    int n = static_cast<int>(red.n);
+    if (n > std::numeric_limits<F>::digits + 1)
+        return ScalePow2(q + 1, n);
+    return ScalePow2(q, n) + (ScalePow2(static_cast<F>(1), n) - 1);
+}
+
+// natural logarithm: x = 2^e * m with m in [sqrt(1/2), sqrt(2)),
+// log(x) = e * ln2 + 2 atanh((m - 1) / (m + 1)), e * ln2 in two parts
+template <typename F, long double Tol = 0.0L>
+F Log(F a_x) noexcept {
+    static_assert(std::is_floating_point_v<F>);
+    if (a_x != a_x || a_x == std::numeric_limits<F>::infinity())
+        return a_x;
+    if (a_x < 0)
+        return std::numeric_limits<F>::quiet_NaN();
+    if (a_x == 0)
+        return -std::numeric_limits<F>::infinity();
+
+    constexpr int K = Tol > 0 ? MKLogOrder<F>(Tol) : MKLogOrder<F>();
+    int e = 0;
+    F m = std::frexp(a_x, &e);  // 1/2 <= m < 1, subnormals included
+    if (m < Sqrt2<F>() / 2)
+        m *= 2, e -= 1;
+    F s = (m - 1) / (m + 1);  // m - 1 is exact
+    F p = 2 * s * evalPoly(LogAtanhCoef<F, K>(), s * s);
+    F k = static_cast<F>(e);
+    return k * Ln2Hi<F>() + (p + k * Ln2Lo<F>());
+}
+
+// {sin(x), cos(x)}: x = k * pi / 2 + r, |r| <= pi / 4, with the three-part
+// split of pi / 2, then Taylor polynomials in r^2 and the quadrant k mod 4.
+// Arguments from PiOver2SplitMax on, where the split's products stop being
+// exact, are reduced by ReducePiOver2Large (Payne-Hanek) instead, so the
+// accuracy holds over the whole finite range; that path is not constexpr.
+template <typename F, long double Tol = 0.0L>
+constexpr std::pair<F, F> SinCos(F a_x) noexcept {
+    static_assert(std::is_floating_point_v<F>);
+    if (a_x != a_x)
+        return {a_x, a_x};
+    if (Abs(a_x) == std::numeric_limits<F>::infinity())
+        return {std::numeric_limits<F>::quiet_NaN(), std::numeric_limits<F>::quiet_NaN()};
+
+    constexpr int N = Tol > 0 ? MKSinCosOrder<F>(Tol) : MKSinCosOrder<F>();
+    F r = 0;
+    int quadrant = 0;
+    if (Abs(a_x) < PiOver2SplitMax<F>()) {
+        F k = (a_x * TwoOverPi<F>() + RoundMagic<F>()) - RoundMagic<F>();
+        r = a_x - k * PiOver2Hi<F>();
+        r -= k * PiOver2Mid<F>();
+        r -= k * PiOver2Lo<F>();
+        // k mod 4 by the same rounding trick
+        F q4 = ((k * static_cast<F>(0.25) - static_cast<F>(0.375)) + RoundMagic<F>()) -
+               RoundMagic<F>();
+        quadrant = static_cast<int>(k - 4 * q4) & 3;
+    } else {
+        ReducedPiOver2<F> red = ReducePiOver2Large(a_x);
+        r = red.r;
+        quadrant = red.quadrant;
+    }
+
+    F r2 = r * r;
+    F s = r * evalPoly(SinTaylorCoef<F, N / 2>(), r2);
+    F c = evalPoly(CosTaylorCoef<F, (N + 1) / 2>(), r2);
+
+    switch (quadrant) {
+        case 0:
+            return {s, c};
+        case 1:
+            return {c, -s};
+        case 2:
+            return {-s, -c};
+        default:
+            return {-c, s};
+    }
+}
+
+}  // namespace ADAAI
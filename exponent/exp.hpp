@@ -1,19 +1,22 @@
 #pragma once
 
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_complex_math.h>
-#include <gsl/gsl_fft_real.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_sf_trig.h>
+#include <algorithm>
+#include <complex>
 #include <cstdint>
-#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "constants.hpp"
+#include "fft.hpp"
+#include "instrument.hpp"
 #include "poly.hpp"
+#include "reduction.hpp"
 
 namespace ADAAI {
 
-enum class Method { Taylor, Pade, Chebyshev, Fourier };
+enum class Method { Taylor, Pade, Chebyshev, Fourier, Table, Minimax };
+static_assert(static_cast<size_t>(Method::Minimax) < ExpCounters::Methods);
 
 template <typename F>
 constexpr F getFourierCoef(const int k) {
@@ -40,199 +43,372 @@ constexpr F chebyshevPoly(F arg, int k) {
     return se;
 }
 
+// Chebyshev-Gauss coefficients of exp(acos(x)):
+//   res[i] = 2 / (N + 1) * sum_j exp(theta_j) T_i(cos theta_j),
+//   theta_j = (2j + 1) pi / (2 (N + 1)), j = 0..N.
+// T_i(cos theta_j) = cos(i theta_j), so the sum is a DCT-II of the samples
+// exp(theta_j): one function evaluation per node and O(N log N) overall.
 template <typename F>
-constexpr void chebyshevGaussQuadrature(const int N, std::vector<F> &res) {
-    std::vector<F> nodes(N + 2);
-    for (int i = 1; i <= N + 1; i++) {  // computing of nodes
-        nodes[i] = std::cos(
-            (static_cast<F>(2 * i - 1) * PI<F>()) /
-            (static_cast<F>(2 * (N + 1)))
+void chebyshevGaussQuadrature(const int N, std::vector<F> &res) {
+    const int M = N + 1;
+    std::vector<F> samples(M);
+    for (int j = 0; j < M; j++) {
+        samples[j] = std::exp(
+            (static_cast<F>(2 * j + 1) * PI<F>()) / (static_cast<F>(2 * M))
         );
     }
 
-    for (int i = 0; i < N + 1; i++) {
-        for (int j = 1; j <= N + 1; j++) {
-            F acos = std::acos(nodes[j]);
-            res[i] += std::exp(acos) * chebyshevPoly(nodes[j], i);
-        }
-        res[i] = (res[i] * static_cast<F>(2)) / (static_cast<F>(N + 1));
+    std::vector<F> sums = dct2(samples);
+    for (int i = 0; i < M; i++) {
+        res[i] = ((res[i] + sums[i]) * static_cast<F>(2)) / (static_cast<F>(M));
     }
 }
 
+// samples of the cosine series sum' coefs[k] cos(k theta) on the uniform grid
+// theta_j = 2 pi j / M, j = 0..M/2, where M = coefs.size() is even. The FFT
+// runs once here; Exp<Method::Fourier> only looks the samples up.
 template <typename F>
-F solveFFT(const int N, F x, std::vector<F> coefs) {
-    double packed[N + 1];  // N + 1 = 2^m
-    memset(packed, 0.0, sizeof(packed));
-    for (int i = 0; i < N + 1; ++i) {
-        packed[i] = static_cast<double>(coefs[i]);
-    }
+std::vector<F> fourierSamples(const std::vector<F> &coefs) {
+    const size_t M = coefs.size();
+    // transformed in long double, so float samples come out correctly rounded
+    std::vector<std::complex<long double>> packed(coefs.begin(), coefs.end());
 
     packed[0] /= 2;
 
-    gsl_fft_real_radix2_transform(packed, 1, N + 1);
+    fft(packed);
 
-    int i = 0;
-    F diff = x;
-    while (i < N) {  // x = pi * index / (N + 1) search for the result
-        F next = 2 * PI<F>() * static_cast<F>(i + 1) / static_cast<F>(N + 1);
-        if (std::abs(x - next) >= diff)
-            break;
-        i++, diff = std::abs(x - next);
+    // the series is real and even in theta: real parts of the first M/2 + 1
+    std::vector<F> samples(M / 2 + 1);
+    for (size_t j = 0; j <= M / 2; ++j) {
+        samples[j] = static_cast<F>(packed[j].real());
     }
-    return static_cast<F>(packed[(i)]);
+    return samples;
 }
 
+// O(1) evaluation of the sampled series at x in [0, pi]: the node index is
+// computed directly from the grid step and the value is interpolated by the
+// cubic Lagrange polynomial through the 4 surrounding nodes
 template <typename F>
-void solveChebyshev(const int N, std::vector<F> &res) {
-    double coef[(N + 1) * (N + 1)];
-    memset(coef, 0., sizeof(coef));
+constexpr F solveFFT(std::span<const F> samples, F x) noexcept {
+    const int last = static_cast<int>(samples.size()) - 1;
+    const F h = PI<F>() / static_cast<F>(last);  // 2 pi / M
+    const F t = x / h;
+    const int i = std::clamp(static_cast<int>(t) - 1, 0, last - 3);
+    const F u = t - static_cast<F>(i);  // x relative to node i, in grid steps
+
+    const F l0 = -(u - 1) * (u - 2) * (u - 3) / 6;
+    const F l1 = u * (u - 2) * (u - 3) / 2;
+    const F l2 = -u * (u - 1) * (u - 3) / 2;
+    const F l3 = u * (u - 1) * (u - 2) / 6;
+    return l0 * samples[i] + l1 * samples[i + 1] + l2 * samples[i + 2] +
+           l3 * samples[i + 3];
+}
+
+// Chebyshev coefficients c_0..c_N of exp on [-1, 1] by the tau method: the
+// rows k < N match the T_k coefficients of y' - y = 0 (the derivative written
+// through the c_n), the last row pins y(0) = sum c_n T_n(0) = 1. Solved in
+// long double by Gaussian elimination with partial pivoting at compile time;
+// solveChebyshev in gsl_coef.hpp builds the same system for GSL.
+template <typename F, int N>
+constexpr std::array<F, N + 1> makeChebyshevCoef() {
+    std::array<std::array<long double, N + 1>, N + 1> A = {};
+    std::array<long double, N + 1> b = {};
     for (int k = 0; k < N; k++) {
-        coef[k * (N + 1) + k] = -1;
+        A[k][k] = -1;
         for (int n = k + 1; n < N + 1; n++) {
             if (n % 2 == 0) {
                 if (k % 2 == 1) {
-                    coef[k * (N + 1) + n] = 2 * n;
+                    A[k][n] = 2 * n;
                 }
             } else {
                 if (k == 0) {
-                    coef[k * (N + 1) + n] = n;
+                    A[k][n] = n;
                 } else if (k % 2 == 0) {
-                    coef[k * (N + 1) + n] = 2 * n;
+                    A[k][n] = 2 * n;
                 }
             }
         }
     }
     for (int n = 0; n < N + 1; n++) {
         if (n % 4 == 0) {
-            coef[N * (N + 1) + n] = 1;
+            A[N][n] = 1;
         } else if (n % 2 == 0) {
-            coef[N * (N + 1) + n] = -1;
+            A[N][n] = -1;
         }
     }
-
-    double b[N + 1];
-    memset(b, 0., sizeof(b));
     b[N] = 1;
 
-    gsl_matrix_view lhs;
-    gsl_vector_view rhs;
+    for (int k = 0; k <= N; k++) {
+        int pivot = k;
+        for (int i = k + 1; i <= N; i++) {
+            if (Abs(A[i][k]) > Abs(A[pivot][k])) {
+                pivot = i;
+            }
+        }
+        std::swap(A[k], A[pivot]);
+        std::swap(b[k], b[pivot]);
+        for (int i = k + 1; i <= N; i++) {
+            long double m = A[i][k] / A[k][k];
+            for (int j = k; j <= N; j++) {
+                A[i][j] -= m * A[k][j];
+            }
+            b[i] -= m * b[k];
+        }
+    }
+
+    std::array<F, N + 1> res = {};
+    std::array<long double, N + 1> x = {};
+    for (int i = N; i >= 0; i--) {
+        long double sum = b[i];
+        for (int j = i + 1; j <= N; j++) {
+            sum -= A[i][j] * x[j];
+        }
+        x[i] = sum / A[i][i];
+        res[i] = static_cast<F>(x[i]);
+    }
+    return res;
+}
 
-    lhs = gsl_matrix_view_array(coef, N + 1, N + 1);
-    rhs = gsl_vector_view_array(b, N + 1);
-    gsl_vector *result = gsl_vector_alloc(N + 1);
+// coefficients of the Chebyshev expansion of exp used by Method::Chebyshev,
+// one compile-time table per type
+template <typename F>
+constexpr inline std::array<F, MKExpTaylorOrder<F>() + 2> ChebyshevCoef =
+    makeChebyshevCoef<F, MKExpTaylorOrder<F>() + 1>();
+
+// Clenshaw recurrence for sum_{i=0}^{n-1} c_i T_i(x): O(n) instead of
+// evaluating every T_i(x) from scratch
+template <typename F, size_t M>
+constexpr F clenshaw(const std::array<F, M> &c, F x) noexcept {
+    F b1 = 0, b2 = 0;
+    for (size_t i = M - 1; i > 0; --i) {
+        F b0 = static_cast<F>(2) * x * b1 - b2 + c[i];
+        b2 = b1;
+        b1 = b0;
+    }
+    return x * b1 - b2 + c[0];
+}
 
-    int signum;
+// Padé approximant [Mp/Np] of exp around 0 in closed form,
+//   P(x) = sum_k (Mp + Np - k)! Mp! / ((Mp + Np)! k! (Mp - k)!) x^k,
+//   Q(x) = P(-x) with Mp and Np swapped,
+// so P(0) = Q(0) = 1 and P / Q - exp(x) = O(x^(Mp + Np + 1)). The ratios are
+// formed in long double and rounded once to F.
+template <typename F, size_t Mp, size_t Np>
+constexpr StaticRational<F, Mp, Np> makePadeExp() {
+    auto term = [](size_t a_m, size_t a_n, size_t a_k) {
+        long double c = 1;
+        for (size_t i = 0; i < a_k; ++i) {
+            c = c * static_cast<long double>(a_m - i) /
+                static_cast<long double>((a_m + a_n - i) * (i + 1));
+        }
+        return c;
+    };
+    StaticRational<F, Mp, Np> res;
+    for (size_t k = 0; k <= Mp; ++k) {
+        res.num.coefficients[k] = static_cast<F>(term(Mp, Np, k));
+    }
+    for (size_t k = 0; k <= Np; ++k) {
+        res.den.coefficients[k] = static_cast<F>(term(Np, Mp, k));
+    }
+    res.den = res.den.reflect();
+    return res;
+}
 
-    gsl_permutation *lhsPermutation = gsl_permutation_alloc(N + 1);
-    gsl_linalg_LU_decomp(&lhs.matrix, lhsPermutation, &signum);
+// the diagonal (or next to diagonal) approximant of total order N that Exp
+// evaluates: P has degree N - N / 2 and Q degree N / 2, both fixed in the type,
+// so the evaluation is unrolled at compile time. It is at least as accurate as
+// the Taylor polynomial of order N and needs about half the multiplications.
+template <typename F, int N = MKExpTaylorOrder<F>()>
+constexpr inline auto PadeExp = makePadeExp<F, N - N / 2, N / 2>();
 
-    gsl_linalg_LU_solve(&lhs.matrix, lhsPermutation, &rhs.vector, result);
+template <typename F, int N = MKExpTaylorOrder<F>()>
+constexpr inline auto PadeNum = PadeExp<F, N>.num.coefficients;
 
-    for (int i = 0; i <= N; ++i) {
-        res[i] = static_cast<F>(gsl_vector_get(result, i));
-    }
+template <typename F, int N = MKExpTaylorOrder<F>()>
+constexpr inline auto PadeDen = PadeExp<F, N>.den.coefficients;
 
-    gsl_vector_free(result);
-    gsl_permutation_free(lhsPermutation);
-}
+// entry k of ExpTable holds 2^(k / 2^L - 1/2) = hi + lo, k = 0..2^L, where lo
+// carries the bits of the long double value that do not fit into hi
+template <typename F>
+struct ExpTableEntry {
+    F hi;
+    F lo;
+};
 
-template <typename F, size_t Capacity>
-constexpr std::pair<Poly<F, Capacity>, Poly<F, Capacity>>
-solvePade(Poly<F, Capacity> T, Poly<F, Capacity> E, size_t n) {
-    Poly<F, Capacity> A(std::array<F, Capacity>({1}));
-    Poly<F, Capacity> B(std::array<F, Capacity>({0}));
-    Poly<F, Capacity> C(std::array<F, Capacity>({0}));
-    Poly<F, Capacity> D(std::array<F, Capacity>({1}));
-
-    while (D.deg < n) {
-        Poly<F, Capacity> div = ((A * E) + (B * T)) / ((C * E) + (D * T));
-        Poly<F, Capacity> C_next = A - div * C;
-        Poly<F, Capacity> D_next = B - div * D;
-        A = C;
-        B = D;
-        C = C_next;
-        D = D_next;
+template <typename F>
+constexpr std::array<ExpTableEntry<F>, (1 << ExpTableBits) + 1> makeExpTable() {
+    constexpr int L = ExpTableBits;
+    std::array<ExpTableEntry<F>, (1 << L) + 1> table = {};
+    for (int k = 0; k <= (1 << L); ++k) {
+        // exp(t) = 1 + expm1(t), |t| <= ln2 / 2: the Taylor terms of expm1 are
+        // summed in long double from the smallest one and 1 is added last
+        long double t = static_cast<long double>(k - (1 << (L - 1))) *
+                        Ln2<long double>() / (1 << L);
+        std::array<long double, 32> terms = {t};
+        int count = 1;
+        while (Abs(terms[count - 1]) > Eps<long double> * Eps<long double>) {
+            terms[count] = terms[count - 1] * t / (count + 1);
+            count++;
+        }
+        long double expm1 = 0;
+        while (count > 0) {
+            expm1 += terms[--count];
+        }
+        long double value = 1 + expm1;
+        table[k].hi = static_cast<F>(value);
+        table[k].lo = static_cast<F>(value - static_cast<long double>(table[k].hi));
     }
-
-    return std::make_pair(C * E + D * T, D);
+    return table;
 }
 
-// constexpr -- compile-time evaluation
-template <Method M = Method::Pade, typename F, size_t Capacity>
-constexpr F Exp(F a_x, std::vector<F> *coefs_fft = nullptr) {
+// 65 entries of 2 * sizeof(F) bytes: stays L1-resident
+template <typename F>
+constexpr inline std::array<ExpTableEntry<F>, (1 << ExpTableBits) + 1> ExpTable =
+    makeExpTable<F>();
+
+// constexpr -- compile-time evaluation: every method but Fourier and both
+// reductions are constant expressions and give the same result as at run time
+// Method::Fourier expects coefs_fft to view fourierSamples(coefs), e.g. a
+// std::vector or a mapped coefficient file (coef_store.hpp)
+// S selects how the Taylor, Minimax, Padé and Table polynomials are evaluated,
+// R how x is reduced to [-ln2/2, ln2/2] and 2^n applied.
+// Tol > 0 is the relative accuracy to aim for: Taylor, Minimax, Padé and Table
+// then use the lowest degree whose truncation error stays below it, and the
+// Cody-Waite reduction drops its second step where that is accurate enough.
+// Tol == 0 keeps the default orders (about 10 * Eps<F> for Taylor).
+// Capacity is unused and kept only for source compatibility.
+template <
+    Method M = Method::Pade,
+    typename F,
+    size_t Capacity,
+    Scheme S = Scheme::Horner,
+    Reduction R = Reduction::Modf,
+    long double Tol = 0.0L>
+constexpr F Exp(F a_x, std::span<const F> coefs_fft = {}) noexcept {
     // F must be floating-point number
     static_assert(std::is_floating_point_v<F>);
+    ADAAI_EXP_COUNT(Call);
+    ADAAI_EXP_COUNT_METHOD(M);
 
     // checking extreme values
-    if (a_x > static_cast<F>((INT32_MAX)))
-        return std::numeric_limits<F>::infinity();  // almost infinity
-    else if (a_x < static_cast<F>((INT32_MIN)))
-        return 0.0;  // almost zero
-
-    // simplify calculations by partitioning x into 2 parts
-    // idea: represent exp(y) as 2^{n + y0}, where n is an integer
-    // and y0 <= 1/2. This form is much more convenient for computation.
+    if (a_x != a_x) {
+        ADAAI_EXP_COUNT(NaN);
+        return a_x;  // NaN, would otherwise index ExpTable with garbage
+    }
 
-    F y = a_x / Ln2<F>();  // y := x / ln2
     F n = NAN;
-    F y0 = std::modf(y, &n);  // y := n + y_0
+    F arg = 0;  // avoid calculating argument several times
+
+    if constexpr (R == Reduction::CodyWaite) {
+        // the result is already inf / 0 outside [ExpMin, ExpMax]; inside, n
+        // stays small enough for the magic-constant rounding and ScalePow2
+        if (a_x > ExpMax<F>()) {
+            ADAAI_EXP_COUNT(RangeHigh);
+            return std::numeric_limits<F>::infinity();
+        } else if (a_x < ExpMin<F>()) {
+            ADAAI_EXP_COUNT(RangeLow);
+            return 0.0;
+        }
 
-    // make |y0| <= 1/2 preserving n + y0 = y
-    if (y0 > 0.5)
-        n += 1, y0 -= 1;
-    else if (y0 < -0.5)
-        n -= 1, y0 += 1;
+        constexpr bool TwoStep = Tol == 0 || Tol < OneStepReductionError<F>();
+        Reduced<F> red = ReduceCodyWaite<F, TwoStep>(a_x);
+        n = red.n;
+        arg = red.r;
+    } else {
+        if (a_x > ExpMax<F>()) {
+            ADAAI_EXP_COUNT(SaturateHigh);
+            return std::numeric_limits<F>::infinity();
+        } else if (a_x < ExpMin<F>()) {
+            ADAAI_EXP_COUNT(SaturateLow);
+            return 0.0;
+        }
 
-    // exp(x) = 2^n * 2^y0 = 2^n * exp(y0 * ln2)
-    // now, we need to compute y1 := 2^y0 = exp(y0 * ln2) and further use
-    // std::ldexp method to get 2^n * y1 = std::ldexp(y1, n).
+        // simplify calculations by partitioning x into 2 parts
+        // idea: represent exp(y) as 2^{n + y0}, where n is an integer
+        // and y0 <= 1/2. This form is much more convenient for computation.
+
+        F y = a_x / Ln2<F>();  // y := x / ln2
+        F y0 = 0;  // y := n + y_0
+        if (std::is_constant_evaluated()) {
+            // std::modf is not constexpr; |y| < 2^Ln2SplitBits fits into
+            // int64_t and y - n is exact
+            n = static_cast<F>(static_cast<int64_t>(y));
+            y0 = y - n;
+        } else {
+            y0 = std::modf(y, &n);
+        }
 
-    // |y0| < 1/2 => |y0 * ln2| < ln2 / 2 => y1 < sqrt(2)
-    // exp(x) = \sum_{k=0}^{N} x^k / k! + R_N(x), where holds
-    // R_N(x) <= e^ksi * x^{N+1} / (N+1)! and ksi in (0, x)
+        // make |y0| <= 1/2 preserving n + y0 = y
+        if (y0 > 0.5) {
+            ADAAI_EXP_COUNT(FixUpUp);
+            n += 1, y0 -= 1;
+        } else if (y0 < -0.5) {
+            ADAAI_EXP_COUNT(FixUpDown);
+            n -= 1, y0 += 1;
+        }
 
-    // Thus,   R_N(y0 * ln2) <
-    //         < e^ksi * (y0 * ln2)^{N+1} / (N+1)! <
-    //         < sqrt(2) * (y0 * ln2)^{N+1} / (N+1)!
-    // we can choose N so that R_N(y0 * ln2) < atol (absolute tolerance)
+        // exp(x) = 2^n * 2^y0 = 2^n * exp(y0 * ln2)
+        // now, we need to compute y1 := 2^y0 = exp(y0 * ln2) and further use
+        // std::ldexp method to get 2^n * y1 = std::ldexp(y1, n).
 
-    F arg = y0 * Ln2<F>();      // avoid calculating argument several times
-    std::vector<F> st = {1.0};  // summing terms for Taylor formula
-    F y1 = 0;
-    constexpr int N =
-        MKExpTaylorOrder<F>();  // compile-time evaluation of order
+        // |y0| < 1/2 => |y0 * ln2| < ln2 / 2 => y1 < sqrt(2)
+        // exp(x) = \sum_{k=0}^{N} x^k / k! + R_N(x), where holds
+        // R_N(x) <= e^ksi * x^{N+1} / (N+1)! and ksi in (0, x)
 
-    if constexpr (M == Method::Taylor) {
-        for (int k = 1; k <= N; k++) {
-            st.push_back(st.back() * arg / k);
-        }
-        // compute y1 = 2^y0 = exp(y0 * ln2) via Taylor formula
-        // we summarize the terms of the Taylor formula in ascending order of
-        // the modulus of the terms to minimize the error of calculations in
-        // floating point numbers arithmetic
+        // Thus,   R_N(y0 * ln2) <
+        //         < e^ksi * (y0 * ln2)^{N+1} / (N+1)! <
+        //         < sqrt(2) * (y0 * ln2)^{N+1} / (N+1)!
+        // we can choose N so that R_N(y0 * ln2) < atol (absolute tolerance)
 
-        for (int i = 0; i < st.size(); ++i)
-            y1 += st[st.size() - i - 1];
-    } else if constexpr (M == Method::Pade) {
-        std::array<F, Capacity> TaylorCoef = {1.0};
-        for (int k = 1; k <= N; k++) {
-            TaylorCoef[k] = TaylorCoef[k - 1] / k;
-        }
+        // y0 * ln2 would carry the rounding error of x / ln2, up to an ulp of
+        // x, into exp; x - n * ln2 from the split ln2 is exact up to far below
+        // an ulp of the result
+        arg = ReduceLn2<F, 2>(a_x, n);
+    }
 
-        std::array<F, Capacity> monomial = {};
-        monomial[N + 1] = 1;
+    F y1 = 0;
+    // compile-time evaluation of order
+    constexpr int N = Tol > 0 ? MKExpTaylorOrder<F>(Tol) : MKExpTaylorOrder<F>();
 
-        auto [P, Q] = solvePade(
-            Poly<F, Capacity>(TaylorCoef), Poly<F, Capacity>(monomial), N / 2
+    if constexpr (M == Method::Taylor) {
+        // compute y1 = 2^y0 = exp(y0 * ln2) via Taylor formula; the order is
+        // a compile-time constant, so the evaluation is fully unrolled
+        y1 = evalPoly<S>(ExpTaylorCoef<F, N>(), arg);
+    } else if constexpr (M == Method::Minimax) {
+        // Remez polynomial from minimax_coef.hpp: same accuracy as Taylor with
+        // fewer terms
+        constexpr int D = Tol > 0 ? MKExpMinimaxOrder<F>(Tol) : MKExpMinimaxOrder<F>();
+        static_assert(
+            Tol == 0 || Tol >= MinimaxExpTable<F>::Error[MinimaxExpTable<F>::MaxDegree],
+            "Tol is tighter than the highest-degree minimax polynomial of "
+            "minimax_coef.hpp reaches"
         );
-
-        y1 = P.eval(arg) / Q.eval(arg);
+        y1 = evalPoly<S>(ExpMinimaxCoef<F, D>(), arg);
+    } else if constexpr (M == Method::Pade) {
+        constexpr int P = N < 2 ? 2 : N;
+        y1 = PadeExp<F, P>.template eval<S>(arg);
     } else if constexpr (M == Method::Chebyshev) {
-        std::vector<F> c(N + 2);
-        solveChebyshev(N + 1, c);
-        for (int i = 0; i <= N + 1; ++i) {
-            y1 += c[i] * chebyshevPoly(arg, i);
-        }
+        y1 = clenshaw(ChebyshevCoef<F>, arg);
+    } else if constexpr (M == Method::Table) {
+        // arg = k * ln2 / 2^L + r with |k| <= 2^(L-1), |r| <= ln2 / 2^(L+1);
+        // exp(arg) = 2^(k / 2^L) * (1 + p(r)), p(r) = exp(r) - 1 of low order
+        constexpr int L = ExpTableBits;
+        constexpr int D = Tol > 0 ? MKExpTableOrder<F>(Tol) : MKExpTableOrder<F>();
+        constexpr std::array<F, D + 1> c = [] {
+            std::array<F, D + 1> expm1 = ExpTaylorCoef<F, D>();
+            expm1[0] = 0;
+            return expm1;
+        }();
+
+        F t = arg * static_cast<F>(1 << L) / Ln2<F>();
+        int k = static_cast<int>(t + (t < 0 ? -0.5 : 0.5));
+        F r = arg - static_cast<F>(k) * (Ln2Hi<F>() / (1 << L));
+        r -= static_cast<F>(k) * (Ln2Lo<F>() / (1 << L));
+
+        F p = evalPoly<S>(c, r);
+
+        const ExpTableEntry<F> &T = ExpTable<F>[k + (1 << (L - 1))];
+        y1 = T.hi + (T.lo + T.hi * p);
     } else if constexpr (M == Method::Fourier) {
         //        if (arg < 0) {
         //            for (int k = 1; k <= N; k++) {
@@ -248,14 +424,48 @@ constexpr F Exp(F a_x, std::vector<F> *coefs_fft = nullptr) {
         //            for (int i = 0; i < st.size(); ++i)
         //                y1 += st[st.size() - i - 1];
         //        } else {
-        if (y0 < 0.0) {
-            n -= 1, y0 += 1;
-            arg = y0 * Ln2<F>();
+        if (arg < 0.0) {
+            ADAAI_EXP_COUNT(FourierShift);
+            n -= 1, arg += Ln2<F>();
         }
-        y1 = solveFFT(coefs_fft->size() - 1, arg, *coefs_fft);
+        y1 = solveFFT(coefs_fft, arg);
         //        }
     }
+    if constexpr (R == Reduction::CodyWaite) {
+        return ScalePow2(y1, static_cast<int>(n));
+    }
+    if (std::is_constant_evaluated()) {
+        // the same correctly rounded 2^n * y1 without std::ldexp
+        return ScalePow2(y1, ClampScaleExponent(n));
+    }
     return std::ldexp(y1, n);  // return 2^n * y1
 }
 
+// exp for callers that need only Tol relative accuracy (1e-6, 1e-9, ...):
+// the lowest degree of M meeting Tol and the Cody-Waite reduction, each
+// tolerance getting its own unrolled kernel. For Minimax, Tol cannot go below
+// the error of the highest tabulated degree,
+// MinimaxExpTable<F>::Error[MaxDegree] (2.0e-9 for float, 3.4e-18 for double,
+// 5.5e-22 for long double); a tighter Tol does not compile.
+template <long double Tol, Method M = Method::Minimax, typename F>
+constexpr F ExpTol(F a_x) noexcept {
+    static_assert(Tol > 0);
+    static_assert(M != Method::Chebyshev && M != Method::Fourier);
+    return Exp<M, F, 32, Scheme::Horner, Reduction::CodyWaite, Tol>(a_x);
+}
+
+// a_fn(a_x0 + i * a_step), i < N. With a constexpr a_fn built on Exp the
+// table is a constant and costs nothing at start-up, e.g. a density profile
+//   constexpr auto rho = tabulate<double, 64>(0.0, 500.0, [](double h) {
+//       return 1.225 * Exp<Method::Table, double, 32>(-h / 8500.0);
+//   });
+template <typename F, size_t N, typename Fn>
+constexpr std::array<F, N> tabulate(F a_x0, F a_step, Fn a_fn) {
+    std::array<F, N> table = {};
+    for (size_t i = 0; i < N; ++i) {
+        table[i] = a_fn(a_x0 + static_cast<F>(i) * a_step);
+    }
+    return table;
+}
+
 }  // namespace ADAAI
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cassert>
+#include <span>
+#include "instrument.hpp"
+#include "simd.hpp"
+
+namespace ADAAI {
+
+// out[i] = exp(in[i]) for float / double arrays. The body runs on the widest
+// kernel the CPU supports (AVX-512, AVX2 + FMA, scalar), the tail elements on
+// the scalar instantiation of the same kernel. Accuracy matches the Taylor
+// order Exp uses (MKExpTaylorOrder<F>()).
+template <typename F>
+void ExpN(std::span<const F> in, std::span<F> out, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out.size() >= in.size());
+
+    const F *x = in.data();
+    F *y = out.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template expArray<F>(x, y, n);
+    });
+    simd::scalar::Kernels::expArray<F>(x + done, y + done, n - done);
+    ADAAI_EXP_COUNT(BatchCall);
+    ADAAI_EXP_COUNT_N(BatchVector, done);
+    ADAAI_EXP_COUNT_N(BatchTail, n - done);
+}
+
+// out[i] = 2^in[i], exp(in[i]) - 1 and log(in[i]) (elementary.hpp), dispatched
+// like ExpN; Tol as for Exp2 / Expm1 / Log
+template <typename F, long double Tol = 0.0L>
+void Exp2N(std::span<const F> in, std::span<F> out, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out.size() >= in.size());
+
+    const F *x = in.data();
+    F *y = out.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template exp2Array<F, Tol>(x, y, n);
+    });
+    simd::scalar::Kernels::exp2Array<F, Tol>(x + done, y + done, n - done);
+}
+
+template <typename F, long double Tol = 0.0L>
+void Expm1N(std::span<const F> in, std::span<F> out, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out.size() >= in.size());
+
+    const F *x = in.data();
+    F *y = out.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template expm1Array<F, Tol>(x, y, n);
+    });
+    simd::scalar::Kernels::expm1Array<F, Tol>(x + done, y + done, n - done);
+}
+
+template <typename F, long double Tol = 0.0L>
+void LogN(std::span<const F> in, std::span<F> out, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out.size() >= in.size());
+
+    const F *x = in.data();
+    F *y = out.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template logArray<F, Tol>(x, y, n);
+    });
+    simd::scalar::Kernels::logArray<F, Tol>(x + done, y + done, n - done);
+}
+
+// out_sin[i] = sin(in[i]), out_cos[i] = cos(in[i]) over the whole finite range:
+// lanes past PiOver2SplitMax are reduced by ReducePiOver2Large, as in SinCos
+template <typename F, long double Tol = 0.0L>
+void SinCosN(
+    std::span<const F> in,
+    std::span<F> out_sin,
+    std::span<F> out_cos,
+    simd::Isa isa = simd::detectIsa()
+) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out_sin.size() >= in.size() && out_cos.size() >= in.size());
+
+    const F *x = in.data();
+    F *ys = out_sin.data();
+    F *yc = out_cos.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template sinCosArray<F, Tol>(x, ys, yc, n);
+    });
+    simd::scalar::Kernels::sinCosArray<F, Tol>(x + done, ys + done, yc + done, n - done);
+}
+
+}  // namespace ADAAI
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "constants.hpp"
+
+namespace ADAAI {
+
+// Header-only FFT for the coefficient set-up code (no GSL): iterative radix-2
+// for power-of-two sizes, Bluestein's chirp-z through a power-of-two transform
+// for every other size, so any length costs O(n log n).
+
+// e^{sign * i pi k / n}, taken directly from cos / sin rather than by repeated
+// multiplication, so that twiddles carry no accumulated rounding
+template <typename F>
+std::complex<F> unitRoot(long long k, long long n, int sign) {
+    long double a = sign * PI<long double>() * static_cast<long double>(k) / n;
+    return {static_cast<F>(std::cos(a)), static_cast<F>(std::sin(a))};
+}
+
+// in-place radix-2 transform, a.size() must be a power of two;
+// X_k = sum_j a_j e^{-2 pi i jk / n} (inverse: +i, not normalized)
+template <typename F>
+void fftRadix2(std::vector<std::complex<F>> &a, bool inverse = false) {
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {  // bit-reversal permutation
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+
+    const int sign = inverse ? 1 : -1;
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const size_t half = len / 2;
+        std::vector<std::complex<F>> w(half);
+        for (size_t k = 0; k < half; ++k) {
+            w[k] = unitRoot<F>(2 * k, len, sign);
+        }
+        for (size_t i = 0; i < n; i += len) {
+            for (size_t k = 0; k < half; ++k) {
+                std::complex<F> u = a[i + k];
+                std::complex<F> v = a[i + k + half] * w[k];
+                a[i + k] = u + v;
+                a[i + k + half] = u - v;
+            }
+        }
+    }
+}
+
+// in-place DFT of any size, same conventions as fftRadix2
+template <typename F>
+void fft(std::vector<std::complex<F>> &a, bool inverse = false) {
+    const size_t n = a.size();
+    if (n <= 1) {
+        return;
+    }
+    if ((n & (n - 1)) == 0) {
+        fftRadix2(a, inverse);
+        return;
+    }
+
+    // Bluestein: jk = (j^2 + k^2 - (k - j)^2) / 2 turns the DFT into a
+    // convolution with the chirp e^{i pi j^2 / n}, done by a radix-2 FFT
+    const int sign = inverse ? 1 : -1;
+    size_t m = 1;
+    while (m < 2 * n - 1) {
+        m <<= 1;
+    }
+    std::vector<std::complex<F>> chirp(n);
+    for (size_t j = 0; j < n; ++j) {
+        // j^2 mod 2n keeps the angle small
+        long long jj = static_cast<long long>(j * j % (2 * n));
+        chirp[j] = unitRoot<F>(jj, n, sign);
+    }
+
+    std::vector<std::complex<F>> u(m), v(m);
+    for (size_t j = 0; j < n; ++j) {
+        u[j] = a[j] * chirp[j];
+    }
+    v[0] = std::conj(chirp[0]);
+    for (size_t j = 1; j < n; ++j) {
+        v[j] = v[m - j] = std::conj(chirp[j]);
+    }
+
+    fftRadix2(u);
+    fftRadix2(v);
+    for (size_t k = 0; k < m; ++k) {
+        u[k] *= v[k];
+    }
+    fftRadix2(u, true);
+
+    const F scale = static_cast<F>(1) / static_cast<F>(m);
+    for (size_t k = 0; k < n; ++k) {
+        a[k] = u[k] * chirp[k] * scale;
+    }
+}
+
+// DCT-II, X_k = sum_{j<n} x_j cos(pi k (2j + 1) / (2n)), by one complex FFT
+// of length n (Makhoul): even samples in order, odd samples reversed
+template <typename F>
+std::vector<F> dct2(const std::vector<F> &x) {
+    const size_t n = x.size();
+    std::vector<std::complex<F>> v(n);
+    for (size_t j = 0; 2 * j < n; ++j) {
+        v[j] = x[2 * j];
+    }
+    for (size_t j = 0; 2 * j + 1 < n; ++j) {
+        v[n - 1 - j] = x[2 * j + 1];
+    }
+
+    fft(v);
+
+    std::vector<F> res(n);
+    for (size_t k = 0; k < n; ++k) {
+        res[k] = (v[k] * unitRoot<F>(static_cast<long long>(k), 2 * n, -1)).real();
+    }
+    return res;
+}
+
+}  // namespace ADAAI
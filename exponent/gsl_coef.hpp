@@ -0,0 +1,86 @@
+#pragma once
+
+// Offline cross-check of the coefficient set-up against GSL. Nothing in the
+// evaluation path includes this header; it needs GSL at build time
+// (ADAAI_HAVE_GSL, see CMakeLists.txt).
+
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_linalg.h>
+#include <cstring>
+#include <vector>
+
+namespace ADAAI {
+
+// the tau-method system of makeChebyshevCoef<F, N>() solved by GSL's LU
+template <typename F>
+void solveChebyshev(const int N, std::vector<F> &res) {
+    double coef[(N + 1) * (N + 1)];
+    memset(coef, 0., sizeof(coef));
+    for (int k = 0; k < N; k++) {
+        coef[k * (N + 1) + k] = -1;
+        for (int n = k + 1; n < N + 1; n++) {
+            if (n % 2 == 0) {
+                if (k % 2 == 1) {
+                    coef[k * (N + 1) + n] = 2 * n;
+                }
+            } else {
+                if (k == 0) {
+                    coef[k * (N + 1) + n] = n;
+                } else if (k % 2 == 0) {
+                    coef[k * (N + 1) + n] = 2 * n;
+                }
+            }
+        }
+    }
+    for (int n = 0; n < N + 1; n++) {
+        if (n % 4 == 0) {
+            coef[N * (N + 1) + n] = 1;
+        } else if (n % 2 == 0) {
+            coef[N * (N + 1) + n] = -1;
+        }
+    }
+
+    double b[N + 1];
+    memset(b, 0., sizeof(b));
+    b[N] = 1;
+
+    gsl_matrix_view lhs;
+    gsl_vector_view rhs;
+
+    lhs = gsl_matrix_view_array(coef, N + 1, N + 1);
+    rhs = gsl_vector_view_array(b, N + 1);
+    gsl_vector *result = gsl_vector_alloc(N + 1);
+
+    int signum;
+
+    gsl_permutation *lhsPermutation = gsl_permutation_alloc(N + 1);
+    gsl_linalg_LU_decomp(&lhs.matrix, lhsPermutation, &signum);
+
+    gsl_linalg_LU_solve(&lhs.matrix, lhsPermutation, &rhs.vector, result);
+
+    for (int i = 0; i <= N; ++i) {
+        res[i] = static_cast<F>(gsl_vector_get(result, i));
+    }
+
+    gsl_vector_free(result);
+    gsl_permutation_free(lhsPermutation);
+}
+
+// fourierSamples by GSL's real radix-2 transform (in double), M = 2^m
+template <typename F>
+std::vector<F> fourierSamplesGsl(const std::vector<F> &coefs) {
+    const size_t M = coefs.size();
+    std::vector<double> packed(M);
+    for (size_t i = 0; i < M; ++i) {
+        packed[i] = static_cast<double>(coefs[i]);
+    }
+
+    packed[0] /= 2;
+
+    gsl_fft_real_radix2_transform(packed.data(), 1, M);
+
+    // half-complex output: real parts of the first M/2 + 1 harmonics
+    return std::vector<F>(packed.begin(), packed.begin() + M / 2 + 1);
+}
+
+}  // namespace ADAAI
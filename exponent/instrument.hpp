@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Optional counters of the paths Exp and ExpN take: compile with
+// -DADAAI_EXP_INSTRUMENT=1 (CMake option ADAAI_EXP_INSTRUMENT). Every thread
+// counts into its own block, so the hot path is a relaxed load and store to a
+// line no other thread writes; expCounters() adds the blocks up on demand,
+// including those of threads that have exited. Without the flag the counting
+// macros expand to nothing and none of this is compiled into Exp.
+
+#ifndef ADAAI_EXP_INSTRUMENT
+#define ADAAI_EXP_INSTRUMENT 0
+#endif
+
+namespace ADAAI {
+
+enum class Method;  // exp.hpp
+
+enum class ExpEvent : size_t {
+    Call,  // scalar Exp, any method
+    NaN,
+    SaturateHigh,  // Modf reduction: x > ExpMax, returns inf
+    SaturateLow,  // Modf reduction: x < ExpMin, returns 0
+    RangeHigh,  // Cody-Waite reduction: x > ExpMax, returns inf
+    RangeLow,  // Cody-Waite reduction: x < ExpMin, returns 0
+    FixUpUp,  // Modf reduction: y0 > 1/2, n += 1
+    FixUpDown,  // Modf reduction: y0 < -1/2, n -= 1
+    FourierShift,  // Fourier: arg < 0 moved to [0, ln2)
+    BatchCall,  // ExpN
+    BatchVector,  // ExpN values done by the SIMD kernel
+    BatchTail,  // ExpN values done by the scalar tail
+    Count
+};
+
+// a snapshot of the counters
+struct ExpCounters {
+    static constexpr size_t Events = static_cast<size_t>(ExpEvent::Count);
+    static constexpr size_t Methods = 8;  // slots for Method values
+
+    std::array<uint64_t, Events> events = {};
+    std::array<uint64_t, Methods> methods = {};
+
+    uint64_t operator[](ExpEvent a_event) const {
+        return events[static_cast<size_t>(a_event)];
+    }
+
+    uint64_t calls(Method a_method) const {
+        return methods[static_cast<size_t>(a_method)];
+    }
+
+    ExpCounters &operator+=(const ExpCounters &a_other) {
+        for (size_t i = 0; i < Events; ++i) {
+            events[i] += a_other.events[i];
+        }
+        for (size_t i = 0; i < Methods; ++i) {
+            methods[i] += a_other.methods[i];
+        }
+        return *this;
+    }
+};
+
+namespace instrument {
+
+// the live block of one thread; the registry reads it while its owner writes
+struct alignas(64) ThreadCounters {
+    std::array<std::atomic<uint64_t>, ExpCounters::Events> events = {};
+    std::array<std::atomic<uint64_t>, ExpCounters::Methods> methods = {};
+
+    ThreadCounters();
+    ~ThreadCounters();
+
+    ExpCounters snapshot() const {
+        ExpCounters res;
+        for (size_t i = 0; i < ExpCounters::Events; ++i) {
+            res.events[i] = events[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < ExpCounters::Methods; ++i) {
+            res.methods[i] = methods[i].load(std::memory_order_relaxed);
+        }
+        return res;
+    }
+
+    void reset() {
+        for (auto &e : events) {
+            e.store(0, std::memory_order_relaxed);
+        }
+        for (auto &m : methods) {
+            m.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadCounters *> live;
+    ExpCounters retired;  // threads that have exited
+};
+
+inline Registry &registry() {
+    static Registry r;
+    return r;
+}
+
+inline ThreadCounters::ThreadCounters() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.live.push_back(this);
+}
+
+inline ThreadCounters::~ThreadCounters() {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired += snapshot();
+    std::erase(r.live, this);
+}
+
+inline ThreadCounters &local() {
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+// only the owning thread writes, so a plain load and store is enough
+inline void bump(std::atomic<uint64_t> &a_counter, uint64_t a_n) {
+    a_counter.store(
+        a_counter.load(std::memory_order_relaxed) + a_n, std::memory_order_relaxed
+    );
+}
+
+// Exp is constexpr: the counters are touched only when it runs at run time
+constexpr void count(ExpEvent a_event, uint64_t a_n = 1) {
+    if (!std::is_constant_evaluated()) {
+        bump(local().events[static_cast<size_t>(a_event)], a_n);
+    }
+}
+
+constexpr void countMethod(Method a_method) {
+    if (!std::is_constant_evaluated()) {
+        bump(local().methods[static_cast<size_t>(a_method)], 1);
+    }
+}
+
+}  // namespace instrument
+
+// the sum over all threads, live and exited, since the last reset
+inline ExpCounters expCounters() {
+    instrument::Registry &r = instrument::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    ExpCounters total = r.retired;
+    for (const instrument::ThreadCounters *t : r.live) {
+        total += t->snapshot();
+    }
+    return total;
+}
+
+// zeroes every counter; increments racing with the reset may survive it
+inline void resetExpCounters() {
+    instrument::Registry &r = instrument::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired = {};
+    for (instrument::ThreadCounters *t : r.live) {
+        t->reset();
+    }
+}
+
+}  // namespace ADAAI
+
+#if ADAAI_EXP_INSTRUMENT
+#define ADAAI_EXP_COUNT(event) ::ADAAI::instrument::count(::ADAAI::ExpEvent::event)
+#define ADAAI_EXP_COUNT_N(event, n) \
+    ::ADAAI::instrument::count(::ADAAI::ExpEvent::event, n)
+#define ADAAI_EXP_COUNT_METHOD(method) ::ADAAI::instrument::countMethod(method)
+#else
+#define ADAAI_EXP_COUNT(event) ((void)0)
+#define ADAAI_EXP_COUNT_N(event, n) ((void)0)
+#define ADAAI_EXP_COUNT_METHOD(method) ((void)0)
+#endif
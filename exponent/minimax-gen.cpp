@@ -0,0 +1,122 @@
+// Offline generator of minimax_coef.hpp: for float, double and long double runs
+// the Remez exchange (remez.hpp) for exp on [-ln2/2, ln2/2] with degrees 1, 2, ...
+// until the relative error bound drops below the requested target, and prints
+// every polynomial on the way, so that callers can pick a degree per accuracy.
+// The constant term is pinned to 1, so that the rounded polynomials keep
+// exp(0) = 1 exactly; a free c0 rounds off 1 by an ulp at low degrees.
+//
+//   ./minimax-gen [rtol_float rtol_double rtol_long_double] > ../minimax_coef.hpp
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "remez.hpp"
+
+using namespace ADAAI;
+
+#ifdef ADAAI_HAVE_QUADMATH
+#include <quadmath.h>
+using Real = __float128;
+static const char *RealName = "__float128";
+
+static Real expReal(Real x) {
+    return expq(x);
+}
+
+static std::string toString(Real x) {
+    char buf[64];
+    quadmath_snprintf(buf, sizeof(buf), "%.36Qe", x);
+    return buf;
+}
+#else
+using Real = long double;
+static const char *RealName = "long double";
+
+static Real expReal(Real x) {
+    return std::exp(x);
+}
+
+static std::string toString(Real x) {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.21Le", x);
+    return buf;
+}
+#endif
+
+template <typename F>
+void emit(const std::string &a_typename, const std::string &a_suffix, long double a_rtol) {
+    const Real b = static_cast<Real>(Ln2<long double>()) / 2;
+
+    std::vector<MinimaxResult<Real>> polys;
+    for (int d = 1; d <= 24; ++d) {
+        polys.push_back(remez<Real>(expReal, -b, b, d, 64, true));
+        std::cerr << a_typename << ": degree " << d << ", error "
+                  << static_cast<long double>(polys.back().error) << ", "
+                  << polys.back().iterations << " iterations" << std::endl;
+        if (polys.back().error <= a_rtol) {
+            break;
+        }
+    }
+    const int max_degree = static_cast<int>(polys.size());
+
+    std::cout << "template <>\n"
+              << "struct MinimaxExpTable<" << a_typename << "> {\n"
+              << "    static constexpr int MaxDegree = " << max_degree << ";\n\n"
+              << "    // Error[d]: max |p_d(x) / exp(x) - 1| of the exact minimax "
+                 "polynomial\n"
+              << "    // with p_d(0) = 1\n"
+              << "    static constexpr std::array<long double, MaxDegree + 1> Error = "
+                 "{\n"
+              << "        1.0L,\n";
+    for (const auto &p : polys) {
+        std::cout << "        " << toString(p.error) << "L,\n";
+    }
+    std::cout << "    };\n\n"
+              << "    // Coef[d][k]: coefficient of x^k in p_d\n"
+              << "    static constexpr std::array<std::array<" << a_typename
+              << ", MaxDegree + 1>, MaxDegree + 1> Coef = {{\n"
+              << "        {1.0" << a_suffix << "},\n";
+    for (const auto &p : polys) {
+        std::cout << "        {\n";
+        for (const Real &c : p.coef) {
+            std::cout << "            " << toString(c) << a_suffix << ",\n";
+        }
+        std::cout << "        },\n";
+    }
+    std::cout << "    }};\n};\n\n";
+}
+
+int main(int argc, char **argv) {
+    long double rtol_f = Eps<float> / 4;
+    long double rtol_d = Eps<double> / 4;
+    long double rtol_l = Eps<long double> / 4;
+    if (argc == 4) {
+        rtol_f = std::strtold(argv[1], nullptr);
+        rtol_d = std::strtold(argv[2], nullptr);
+        rtol_l = std::strtold(argv[3], nullptr);
+    } else if (argc != 1) {
+        std::cerr << "usage: " << argv[0]
+                  << " [rtol_float rtol_double rtol_long_double]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "// Generated by minimax-gen (Remez exchange in " << RealName
+              << ") -- do not edit.\n"
+              << "// Minimax polynomials p_d(x) ~ exp(x) on [-ln2/2, ln2/2] in the "
+                 "relative error\n"
+              << "// sense with p_d(0) = 1 pinned, degrees d = 1..MaxDegree. Verify with\n"
+              << "// minimax-verify.\n"
+              << "#pragma once\n\n"
+              << "#include <array>\n\n"
+              << "namespace ADAAI {\n\n"
+              << "template <typename F>\n"
+              << "struct MinimaxExpTable;\n\n";
+    emit<float>("float", "f", rtol_f);
+    emit<double>("double", "", rtol_d);
+    emit<long double>("long double", "L", rtol_l);
+    std::cout << "}  // namespace ADAAI\n";
+    return 0;
+}
@@ -0,0 +1,83 @@
+// Verifier of minimax_coef.hpp: evaluates every stored polynomial in its own
+// type on a dense grid of [-ln2/2, ln2/2] and compares the relative error with
+// the bound the generator recorded. Rounding the coefficients and the Horner
+// evaluation add a few ulp on top of the bound; anything beyond that means the
+// header is stale or broken, and the program exits with status 1.
+//
+//   ./minimax-verify [points]
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "constants.hpp"
+#include "poly.hpp"
+
+using namespace ADAAI;
+
+#ifdef ADAAI_HAVE_QUADMATH
+#include <quadmath.h>
+using Real = __float128;
+
+static Real expReal(Real x) {
+    return expq(x);
+}
+#else
+using Real = long double;
+
+static Real expReal(Real x) {
+    return std::exp(x);
+}
+#endif
+
+template <typename F, int D>
+bool verifyDegree(const std::string &a_typename, long a_points) {
+    const long double b = Ln2<long double>() / 2;
+    constexpr std::array<F, D + 1> c = ExpMinimaxCoef<F, D>();
+
+    long double worst = 0, worst_x = 0;
+    for (long i = 0; i <= a_points; ++i) {
+        F x = static_cast<F>(-b + 2 * b * i / a_points);
+        Real y = static_cast<Real>(evalPoly(c, x));
+        long double err = static_cast<long double>(y / expReal(x) - 1);
+        if (Abs(err) > worst) {
+            worst = Abs(err), worst_x = x;
+        }
+    }
+
+    const long double bound = MinimaxExpTable<F>::Error[D];
+    const bool ok = worst <= bound + 4 * Eps<F>;
+    std::cout << a_typename << " degree " << D << ": bound " << bound
+              << ", measured " << worst << " at x = " << worst_x
+              << (ok ? "" : "  <-- FAILED") << std::endl;
+    return ok;
+}
+
+template <typename F, int... D>
+bool verifyAll(
+    const std::string &a_typename,
+    long a_points,
+    std::integer_sequence<int, D...>
+) {
+    // every degree runs, even after a failure
+    return (verifyDegree<F, D + 1>(a_typename, a_points) & ...);
+}
+
+template <typename F>
+bool verify(const std::string &a_typename, long a_points) {
+    constexpr int MaxDegree = MinimaxExpTable<F>::MaxDegree;
+    std::cout << a_typename << ": MKExpMinimaxOrder = " << MKExpMinimaxOrder<F>()
+              << ", MKExpTaylorOrder = " << MKExpTaylorOrder<F>() << std::endl;
+    return verifyAll<F>(
+        a_typename, a_points, std::make_integer_sequence<int, MaxDegree>()
+    );
+}
+
+int main(int argc, char **argv) {
+    long points = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 1 << 18;
+
+    bool ok = verify<float>("float", points);
+    ok &= verify<double>("double", points);
+    ok &= verify<long double>("long double", points);
+    return ok ? 0 : 1;
+}
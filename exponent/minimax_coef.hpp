@@ -0,0 +1,360 @@
+// Generated by minimax-gen (Remez exchange in __float128) -- do not edit.
+// Minimax polynomials p_d(x) ~ exp(x) on [-ln2/2, ln2/2] in the relative error
+// sense with p_d(0) = 1 pinned, degrees d = 1..MaxDegree. Verify with
+// minimax-verify.
+#pragma once
+
+#include <array>
+
+namespace ADAAI {
+
+template <typename F>
+struct MinimaxExpTable;
+
+template <>
+struct MinimaxExpTable<float> {
+    static constexpr int MaxDegree = 6;
+
+    // Error[d]: max |p_d(x) / exp(x) - 1| of the exact minimax polynomial
+    // with p_d(0) = 1
+    static constexpr std::array<long double, MaxDegree + 1> Error = {
+        1.0L,
+        5.719095841793663413400802361894504015e-02L,
+        1.963394321978672746946404528675476027e-03L,
+        1.012878248320752959865171185957698373e-04L,
+        2.819762541696714613766047027907458278e-06L,
+        9.147737502761724770060447365537670253e-08L,
+        1.974516450554024101430770365821280765e-09L,
+    };
+
+    // Coef[d][k]: coefficient of x^k in p_d
+    static constexpr std::array<std::array<float, MaxDegree + 1>, MaxDegree + 1> Coef = {{
+        {1.0f},
+        {
+            1.000000000000000000000000000000000000e+00f,
+            9.617966939259756049054112217359050295e-01f,
+        },
+        {
+            1.000000000000000000000000000000000000e+00f,
+            1.014130643069961830051805236010054560e+00f,
+            4.992455523334134528862358662985647898e-01f,
+        },
+        {
+            1.000000000000000000000000000000000000e+00f,
+            1.000195840854937134913307383454239386e+00f,
+            5.041303774900920168648875442554065867e-01f,
+            1.651797571175554783241889493011231019e-01f,
+        },
+        {
+            1.000000000000000000000000000000000000e+00f,
+            9.999668365642803205653046201594448835e-01f,
+            5.000301364322352808522899023441422937e-01f,
+            1.678747331820937967035377105782519623e-01f,
+            4.151384756936072100514986791095766653e-02f,
+        },
+        {
+            1.000000000000000000000000000000000000e+00f,
+            9.999997071894993461080869017709893437e-01f,
+            4.999914953071111387075141510244375180e-01f,
+            1.666763619475493348904841037803848847e-01f,
+            4.189792929644947171996042126398347745e-02f,
+            8.290314718548294972163386723970699151e-03f,
+        },
+        {
+            1.000000000000000000000000000000000000e+00f,
+            1.000000032165030171300609037920348074e+00f,
+            4.999999420905272632565833227847069005e-01f,
+            1.666643126270281847713954662118754659e-01f,
+            4.166800203473703919862429510391150810e-02f,
+            8.374155305794460433162630696099898755e-03f,
+            1.384365354345332732984021796542888528e-03f,
+        },
+    }};
+};
+
+template <>
+struct MinimaxExpTable<double> {
+    static constexpr int MaxDegree = 11;
+
+    // Error[d]: max |p_d(x) / exp(x) - 1| of the exact minimax polynomial
+    // with p_d(0) = 1
+    static constexpr std::array<long double, MaxDegree + 1> Error = {
+        1.0L,
+        5.719095841793663413400802361894504015e-02L,
+        1.963394321978672746946404528675476027e-03L,
+        1.012878248320752959865171185957698373e-04L,
+        2.819762541696714613766047027907458278e-06L,
+        9.147737502761724770060447365537670253e-08L,
+        1.974516450554024101430770365821280765e-09L,
+        4.665977658753723043610302153533983040e-11L,
+        8.135643873087238237149361795222641504e-13L,
+        1.511344927710277442003127839678662309e-14L,
+        2.203297002367186929102119926930086014e-16L,
+        3.371344399643769148643494811656562722e-18L,
+    };
+
+    // Coef[d][k]: coefficient of x^k in p_d
+    static constexpr std::array<std::array<double, MaxDegree + 1>, MaxDegree + 1> Coef = {{
+        {1.0},
+        {
+            1.000000000000000000000000000000000000e+00,
+            9.617966939259756049054112217359050295e-01,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.014130643069961830051805236010054560e+00,
+            4.992455523334134528862358662985647898e-01,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.000195840854937134913307383454239386e+00,
+            5.041303774900920168648875442554065867e-01,
+            1.651797571175554783241889493011231019e-01,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            9.999668365642803205653046201594448835e-01,
+            5.000301364322352808522899023441422937e-01,
+            1.678747331820937967035377105782519623e-01,
+            4.151384756936072100514986791095766653e-02,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            9.999997071894993461080869017709893437e-01,
+            4.999914953071111387075141510244375180e-01,
+            1.666763619475493348904841037803848847e-01,
+            4.189792929644947171996042126398347745e-02,
+            8.290314718548294972163386723970699151e-03,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.000000032165030171300609037920348074e+00,
+            4.999999420905272632565833227847069005e-01,
+            1.666643126270281847713954662118754659e-01,
+            4.166800203473703919862429510391150810e-02,
+            8.374155305794460433162630696099898755e-03,
+            1.384365354345332732984021796542888528e-03,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.000000000208594359570850200212829501e+00,
+            5.000000077146148565788861193620191080e-01,
+            1.666666516380507531327494928115644096e-01,
+            4.166627255170155367296323555875686353e-02,
+            8.333568897200041401066750203247506493e-03,
+            1.394589775712328242285643817537054948e-03,
+            1.976767241236887942305608950999842689e-04,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            9.999999999830729968333071776556247169e-01,
+            5.000000000458008871768226983931739207e-01,
+            1.666666687321006891404820965798661746e-01,
+            4.166666453742481421330826667868713309e-02,
+            8.333268780757052170155731714771155468e-03,
+            1.388915494343603909777925191693592653e-03,
+            1.991466596310338124853151075481923030e-04,
+            2.473298751056930644439788285070049532e-05,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            9.999999999999132280676031923810906062e-01,
+            4.999999999961025828980922239912192219e-01,
+            1.666666666774590942194225494281287072e-01,
+            4.166666698522964168848192354855745019e-02,
+            8.333333007741455756977210671460433336e-03,
+            1.388880818140361587397550721766648420e-03,
+            1.984160312841941505916612512253514597e-04,
+            2.488200158620736942842955428379671905e-05,
+            2.747678361857163513913286581777845152e-06,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.000000000000005577766441960078284559e+00,
+            4.999999999999798200875223817694907126e-01,
+            1.666666666656464257394772398989721537e-01,
+            4.166666666820293766389231237123308266e-02,
+            8.333333382940389246315642420697805547e-03,
+            1.388888852903787074675612111244636844e-03,
+            1.984117308941264207474986584430478757e-04,
+            2.480190030648920219494893181053427735e-05,
+            2.763918653746675310503942497230125283e-06,
+            2.749197583188051083589512175697102998e-07,
+        },
+        {
+            1.000000000000000000000000000000000000e+00,
+            1.000000000000000023642892877976330965e+00,
+            5.000000000000012493805250862296618203e-01,
+            1.666666666666621723066389959934577688e-01,
+            4.166666666651782833567217840081075671e-02,
+            8.333333333549691458311957044647526994e-03,
+            1.388888894635273693211708719879415767e-03,
+            1.984126943679623833592119460139318668e-04,
+            2.480149063647577937995576472792342591e-05,
+            2.755762669856230092900888013779561446e-06,
+            2.763103404331443131997333119572804976e-07,
+            2.499143215398714233534400552332891527e-08,
+        },
+    }};
+};
+
+template <>
+struct MinimaxExpTable<long double> {
+    static constexpr int MaxDegree = 13;
+
+    // Error[d]: max |p_d(x) / exp(x) - 1| of the exact minimax polynomial
+    // with p_d(0) = 1
+    static constexpr std::array<long double, MaxDegree + 1> Error = {
+        1.0L,
+        5.719095841793663413400802361894504015e-02L,
+        1.963394321978672746946404528675476027e-03L,
+        1.012878248320752959865171185957698373e-04L,
+        2.819762541696714613766047027907458278e-06L,
+        9.147737502761724770060447365537670253e-08L,
+        1.974516450554024101430770365821280765e-09L,
+        4.665977658753723043610302153533983040e-11L,
+        8.135643873087238237149361795222641504e-13L,
+        1.511344927710277442003127839678662309e-14L,
+        2.203297002367186929102119926930086014e-16L,
+        3.371344399643769148643494811656562722e-18L,
+        4.217294432201448374893905831446554053e-20L,
+        5.485383777245554630581582915571697511e-22L,
+    };
+
+    // Coef[d][k]: coefficient of x^k in p_d
+    static constexpr std::array<std::array<long double, MaxDegree + 1>, MaxDegree + 1> Coef = {{
+        {1.0L},
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.617966939259756049054112217359050295e-01L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.014130643069961830051805236010054560e+00L,
+            4.992455523334134528862358662985647898e-01L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.000195840854937134913307383454239386e+00L,
+            5.041303774900920168648875442554065867e-01L,
+            1.651797571175554783241889493011231019e-01L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999668365642803205653046201594448835e-01L,
+            5.000301364322352808522899023441422937e-01L,
+            1.678747331820937967035377105782519623e-01L,
+            4.151384756936072100514986791095766653e-02L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999997071894993461080869017709893437e-01L,
+            4.999914953071111387075141510244375180e-01L,
+            1.666763619475493348904841037803848847e-01L,
+            4.189792929644947171996042126398347745e-02L,
+            8.290314718548294972163386723970699151e-03L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.000000032165030171300609037920348074e+00L,
+            4.999999420905272632565833227847069005e-01L,
+            1.666643126270281847713954662118754659e-01L,
+            4.166800203473703919862429510391150810e-02L,
+            8.374155305794460433162630696099898755e-03L,
+            1.384365354345332732984021796542888528e-03L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.000000000208594359570850200212829501e+00L,
+            5.000000077146148565788861193620191080e-01L,
+            1.666666516380507531327494928115644096e-01L,
+            4.166627255170155367296323555875686353e-02L,
+            8.333568897200041401066750203247506493e-03L,
+            1.394589775712328242285643817537054948e-03L,
+            1.976767241236887942305608950999842689e-04L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999999999830729968333071776556247169e-01L,
+            5.000000000458008871768226983931739207e-01L,
+            1.666666687321006891404820965798661746e-01L,
+            4.166666453742481421330826667868713309e-02L,
+            8.333268780757052170155731714771155468e-03L,
+            1.388915494343603909777925191693592653e-03L,
+            1.991466596310338124853151075481923030e-04L,
+            2.473298751056930644439788285070049532e-05L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999999999999132280676031923810906062e-01L,
+            4.999999999961025828980922239912192219e-01L,
+            1.666666666774590942194225494281287072e-01L,
+            4.166666698522964168848192354855745019e-02L,
+            8.333333007741455756977210671460433336e-03L,
+            1.388880818140361587397550721766648420e-03L,
+            1.984160312841941505916612512253514597e-04L,
+            2.488200158620736942842955428379671905e-05L,
+            2.747678361857163513913286581777845152e-06L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.000000000000005577766441960078284559e+00L,
+            4.999999999999798200875223817694907126e-01L,
+            1.666666666656464257394772398989721537e-01L,
+            4.166666666820293766389231237123308266e-02L,
+            8.333333382940389246315642420697805547e-03L,
+            1.388888852903787074675612111244636844e-03L,
+            1.984117308941264207474986584430478757e-04L,
+            2.480190030648920219494893181053427735e-05L,
+            2.763918653746675310503942497230125283e-06L,
+            2.749197583188051083589512175697102998e-07L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            1.000000000000000023642892877976330965e+00L,
+            5.000000000000012493805250862296618203e-01L,
+            1.666666666666621723066389959934577688e-01L,
+            4.166666666651782833567217840081075671e-02L,
+            8.333333333549691458311957044647526994e-03L,
+            1.388888894635273693211708719879415767e-03L,
+            1.984126943679623833592119460139318668e-04L,
+            2.480149063647577937995576472792342591e-05L,
+            2.755762669856230092900888013779561446e-06L,
+            2.763103404331443131997333119572804976e-07L,
+            2.499143215398714233534400552332891527e-08L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999999999999999987423365304282339765e-01L,
+            5.000000000000000057020652383733492749e-01L,
+            1.666666666666669884463260908116539243e-01L,
+            4.166666666666602723954724801882468692e-02L,
+            8.333333333310988257947930885340418771e-03L,
+            1.388888888912252736082242831578616650e-03L,
+            1.984126990664786174809373846177762052e-04L,
+            2.480158693518410594715293104069896488e-05L,
+            2.755722698622542361432006662326168957e-06L,
+            2.755756475949519638777155780745203464e-07L,
+            2.511427879073232299103458962734836238e-08L,
+            2.083365351263779129509081636875449073e-09L,
+        },
+        {
+            1.000000000000000000000000000000000000e+00L,
+            9.999999999999999999954554384820580990e-01L,
+            4.999999999999999997238278647384959453e-01L,
+            1.666666666666666678900344476589584876e-01L,
+            4.166666666666671175422545910540788552e-02L,
+            8.333333333333248129445295856602670285e-03L,
+            1.388888888886441483278105271222296605e-03L,
+            1.984126984151441431206499854197013041e-04L,
+            2.480158736258478533847559306559711099e-05L,
+            2.755731889434080548675782275182528648e-06L,
+            2.755724244736779416719156444691541523e-07L,
+            2.505230777771973689446307512906013268e-08L,
+            2.092424799626016983093742913115418596e-09L,
+            1.602575743406977809182893928068676022e-10L,
+        },
+    }};
+};
+
+}  // namespace ADAAI
@@ -4,62 +4,115 @@
 #include <array>
 #include <cassert>
 #include <cstdio>
-#include <vector>
+#include <ostream>
+#include <utility>
 #include "constants.hpp"
+#include "eft.hpp"
 
 namespace ADAAI {
+
+enum class Scheme { Horner, CompensatedHorner, Estrin };
+
+// c[0] + c[1] x + ... + c[count-1] x^(count-1) without any allocation. With the
+// default count = M the degree is a compile-time constant and the loops unroll.
+//   Horner            - count - 1 dependent FMAs, the shortest code
+//   CompensatedHorner - Horner plus the running sum of the rounding errors of
+//                       every step (TwoProd / TwoSum): as accurate as Horner in
+//                       twice the working precision
+//   Estrin            - pairs terms with x, x^2, x^4, ...: log2(count) deep
+//                       dependency chain, independent FMAs fill the pipeline
+template <Scheme S = Scheme::Horner, typename F, size_t M>
+constexpr F evalPoly(const std::array<F, M> &c, F x, size_t count = M) {
+    static_assert(M > 0);
+    assert(count > 0 && count <= M);
+    if constexpr (S == Scheme::Horner) {
+        F p = c[count - 1];
+#pragma GCC unroll 64
+        for (size_t i = 2; i <= count; ++i) {
+            p = p * x + c[count - i];
+        }
+        return p;
+    } else if constexpr (S == Scheme::CompensatedHorner) {
+        F s = c[count - 1];
+        F r = 0;
+#pragma GCC unroll 64
+        for (size_t i = 2; i <= count; ++i) {
+            auto [p, pi] = TwoProd(s, x);
+            auto [t, sigma] = TwoSum(p, c[count - i]);
+            s = t;
+            r = r * x + (pi + sigma);
+        }
+        return s + r;
+    } else {
+        std::array<F, M> a = c;
+        F xp = x;
+        for (size_t m = count; m > 1; m = (m + 1) / 2) {
+#pragma GCC unroll 64
+            for (size_t i = 0; 2 * i + 1 < m; ++i) {
+                a[i] = a[2 * i] + a[2 * i + 1] * xp;
+            }
+            if (m % 2 == 1) {
+                a[m / 2] = a[m - 1];
+            }
+            xp *= xp;
+        }
+        return a[0];
+    }
+}
+
 template <typename F, size_t N>
 class Poly {
 public:
     std::array<F, N> coefficients;
     size_t deg;
 
-    explicit Poly(const std::array<F, N> &a_coefficients)
+    constexpr explicit Poly(const std::array<F, N> &a_coefficients)
         : coefficients(a_coefficients) {
         deg = N - 1;
-        while (std::abs(a_coefficients[deg]) < (F)10.0 * ADAAI::Eps<F> &&
+        while (Abs(a_coefficients[deg]) < (F)10.0 * ADAAI::Eps<F> &&
                deg != 0)
             coefficients[deg--] = 0;
     }
 
-    [[nodiscard]] F eval(F a_x) const {
-        F v = 0.0;
-        F p = 1.0;
-        std::vector<F> terms;
-        // evaluate poly(a_x)
-        for (F coef : coefficients) {
-            terms.push_back(p * coef);
-            p *= a_x;
+    template <Scheme S = Scheme::Horner>
+    [[nodiscard]] constexpr F eval(F a_x) const {
+        return evalPoly<S>(coefficients, a_x, deg + 1);
+    }
+
+    // the first M coefficients; head<P.deg + 1>() of a constexpr Poly P is a
+    // table whose length is the exact degree
+    template <size_t M>
+    [[nodiscard]] constexpr std::array<F, M> head() const {
+        static_assert(M <= N);
+        std::array<F, M> res = {};
+        for (size_t i = 0; i < M; ++i) {
+            res[i] = coefficients[i];
         }
-        // summate ascending modulus of the terms
-        std::reverse(terms.begin(), terms.end());
-        for (F term : terms)
-            v += term;
-        return v;
+        return res;
     }
 
-    Poly<F, N> operator-(const Poly<F, N> &other) {
+    constexpr Poly<F, N> operator-(const Poly<F, N> &other) const {
         std::array<F, N> sub = coefficients;
         for (size_t i = 0; i <= std::max(other.deg, deg); i++)
             sub[i] -= other.coefficients[i];
         return Poly<F, N>(sub);
     };
 
-    Poly<F, N> operator+(const Poly<F, N> &other) {
+    constexpr Poly<F, N> operator+(const Poly<F, N> &other) const {
         std::array<F, N> sum = coefficients;
         for (size_t i = 0; i <= std::max(other.deg, deg); i++)
             sum[i] += other.coefficients[i];
         return Poly<F, N>(sum);
     };
 
-    Poly<F, N> &operator+=(const Poly<F, N> &other) {
+    constexpr Poly<F, N> &operator+=(const Poly<F, N> &other) {
         for (size_t i = 0; i <= std::max(other.deg, deg); i++)
             coefficients[i] += other.coefficients[i];
         deg = std::max(other.deg, deg);
         return *this;
     };
 
-    Poly<F, N> operator*(const Poly<F, N> &other) {
+    constexpr Poly<F, N> operator*(const Poly<F, N> &other) const {
         std::array<F, N> mul = {};
         assert(deg + other.deg < N);
         for (size_t i = 0; i <= deg; i++) {
@@ -70,7 +123,7 @@ public:
         return Poly<F, N>(mul);
     };
 
-    Poly<F, N> &operator*=(const Poly<F, N> &other) {
+    constexpr Poly<F, N> &operator*=(const Poly<F, N> &other) {
         std::array<F, N> mul = {};
         assert(deg + other.deg < N);
         for (size_t i = 0; i <= deg; i++) {
@@ -84,7 +137,7 @@ public:
     };
 
     // => Horner's method <=
-    Poly<F, N> operator/(const Poly<F, N> &other) {
+    constexpr Poly<F, N> operator/(const Poly<F, N> &other) const {
         std::array<F, N> res = coefficients;
         int cur = deg;
         while (cur >= static_cast<int>(other.deg)) {
@@ -111,4 +164,155 @@ public:
         return os;
     }
 };
-}  // namespace ADAAI
\ No newline at end of file
+
+// Polynomial c[0] + c[1] x + ... + c[D] x^D whose degree bound D is part of the
+// type: sums have degree max(D1, D2), products D1 + D2, quotients D1 - D2, all
+// known at compile time, so every loop has a constant bound and unrolls.
+// Unlike Poly, no coefficient is ever dropped; a zero leading coefficient is
+// allowed everywhere except in a divisor.
+template <typename F, size_t D>
+struct StaticPoly {
+    static constexpr size_t Degree = D;
+    std::array<F, D + 1> coefficients = {};
+
+    constexpr StaticPoly() = default;
+
+    constexpr explicit StaticPoly(const std::array<F, D + 1> &a_coefficients)
+        : coefficients(a_coefficients) {}
+
+    // the monomial x^D
+    static constexpr StaticPoly monomial() {
+        StaticPoly p;
+        p.coefficients[D] = 1;
+        return p;
+    }
+
+    // coefficient of x^i, zero above D
+    constexpr F operator[](size_t i) const {
+        return i <= D ? coefficients[i] : F(0);
+    }
+
+    template <Scheme S = Scheme::Horner>
+    [[nodiscard]] constexpr F eval(F a_x) const {
+        return evalPoly<S>(coefficients, a_x);
+    }
+
+    // the coefficients up to x^E: truncation mod x^(E + 1) or zero padding
+    template <size_t E>
+    [[nodiscard]] constexpr StaticPoly<F, E> resize() const {
+        StaticPoly<F, E> res;
+        for (size_t i = 0; i <= std::min(D, E); ++i) {
+            res.coefficients[i] = coefficients[i];
+        }
+        return res;
+    }
+
+    // p(-x)
+    [[nodiscard]] constexpr StaticPoly reflect() const {
+        StaticPoly res = *this;
+        for (size_t i = 1; i <= D; i += 2) {
+            res.coefficients[i] = -res.coefficients[i];
+        }
+        return res;
+    }
+
+    [[nodiscard]] constexpr StaticPoly<F, (D > 0 ? D - 1 : 0)> derivative() const {
+        StaticPoly<F, (D > 0 ? D - 1 : 0)> res;
+        for (size_t i = 1; i <= D; ++i) {
+            res.coefficients[i - 1] = static_cast<F>(i) * coefficients[i];
+        }
+        return res;
+    }
+
+    constexpr StaticPoly operator-() const {
+        StaticPoly res;
+        for (size_t i = 0; i <= D; ++i) {
+            res.coefficients[i] = -coefficients[i];
+        }
+        return res;
+    }
+
+    template <size_t D2>
+    constexpr StaticPoly<F, std::max(D, D2)> operator+(const StaticPoly<F, D2> &other
+    ) const {
+        StaticPoly<F, std::max(D, D2)> res;
+        for (size_t i = 0; i <= std::max(D, D2); ++i) {
+            res.coefficients[i] = (*this)[i] + other[i];
+        }
+        return res;
+    }
+
+    template <size_t D2>
+    constexpr StaticPoly<F, std::max(D, D2)> operator-(const StaticPoly<F, D2> &other
+    ) const {
+        return *this + (-other);
+    }
+
+    template <size_t D2>
+    constexpr StaticPoly<F, D + D2> operator*(const StaticPoly<F, D2> &other) const {
+        StaticPoly<F, D + D2> res;
+        for (size_t i = 0; i <= D; ++i) {
+            for (size_t j = 0; j <= D2; ++j) {
+                res.coefficients[i + j] += coefficients[i] * other.coefficients[j];
+            }
+        }
+        return res;
+    }
+
+    constexpr StaticPoly operator*(F a_scale) const {
+        StaticPoly res = *this;
+        for (F &c : res.coefficients) {
+            c *= a_scale;
+        }
+        return res;
+    }
+
+    // quotient of the long division by a divisor of exact degree D2
+    template <size_t D2>
+    constexpr StaticPoly<F, D - D2> operator/(const StaticPoly<F, D2> &other) const {
+        return divide(other).first;
+    }
+
+    // remainder, of degree below D2
+    template <size_t D2>
+    constexpr StaticPoly<F, (D2 > 0 ? D2 - 1 : 0)> operator%(const StaticPoly<F, D2> &o
+    ) const {
+        return divide(o).second;
+    }
+
+    template <size_t D2>
+    constexpr std::pair<StaticPoly<F, D - D2>, StaticPoly<F, (D2 > 0 ? D2 - 1 : 0)>>
+    divide(const StaticPoly<F, D2> &other) const {
+        static_assert(D2 <= D, "the divisor must not have a higher degree");
+        std::array<F, D + 1> res = coefficients;
+        for (size_t cur = D + 1; cur-- > D2;) {
+            res[cur] /= other.coefficients[D2];
+            for (size_t i = 1; i <= D2; ++i) {
+                res[cur - i] -= res[cur] * other.coefficients[D2 - i];
+            }
+        }
+        StaticPoly<F, D - D2> quotient;
+        for (size_t i = D2; i <= D; ++i) {
+            quotient.coefficients[i - D2] = res[i];
+        }
+        StaticPoly<F, (D2 > 0 ? D2 - 1 : 0)> remainder;
+        for (size_t i = 0; i < D2; ++i) {
+            remainder.coefficients[i] = res[i];
+        }
+        return {quotient, remainder};
+    }
+};
+
+// P(x) / Q(x) with static degrees M and N
+template <typename F, size_t M, size_t N>
+struct StaticRational {
+    StaticPoly<F, M> num;
+    StaticPoly<F, N> den;
+
+    template <Scheme S = Scheme::Horner>
+    [[nodiscard]] constexpr F eval(F a_x) const {
+        return num.template eval<S>(a_x) / den.template eval<S>(a_x);
+    }
+};
+
+}  // namespace ADAAI
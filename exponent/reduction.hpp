@@ -0,0 +1,225 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "constants.hpp"
+#include "eft.hpp"
+
+namespace ADAAI {
+
+// how Exp splits x = n * ln2 + r before evaluating exp(r):
+//   Modf      -- n from std::modf(x / ln2), r = ReduceLn2(x, n), 2^n applied by
+//                std::ldexp (in constant expressions: by truncation and
+//                ScalePow2)
+//   CodyWaite -- n = round(x * log2 e) by the magic-constant trick,
+//                r = ReduceLn2(x, n), 2^n written into the exponent field; no
+//                library calls
+// Both find r with the split of ln2 from Ln2Parts, which the vector kernels
+// (simd_kernels.inc) use as well.
+enum class Reduction { Modf, CodyWaite };
+
+// adding and subtracting 1.5 * 2^(digits - 1) rounds |t| < 2^(digits - 2) to
+// the nearest integer in the current (round-to-nearest) mode
+template <typename F>
+constexpr inline F RoundMagic() {
+    constexpr int Digits = std::numeric_limits<F>::digits;
+    F magic = 1.5;
+    for (int k = 1; k < Digits; k++) {
+        magic *= 2;
+    }
+    return magic;
+}
+
+// 2^k for an exponent k of a normal number, built from the bit pattern
+template <typename F>
+constexpr inline F Pow2(int k) {
+    if constexpr (std::is_same_v<F, float>) {
+        return std::bit_cast<float>(static_cast<uint32_t>(k + 127) << 23);
+    } else if constexpr (std::is_same_v<F, double>) {
+        return std::bit_cast<double>(static_cast<uint64_t>(k + 1023) << 52);
+    } else if constexpr (std::numeric_limits<F>::digits == 64 && sizeof(F) == 16) {
+        // x87 extended precision: explicit integer bit, 15-bit exponent
+        struct {
+            uint64_t mantissa;
+            uint16_t exponent;
+            uint16_t padding[3];
+        } bits = {uint64_t(1) << 63, static_cast<uint16_t>(k + 16383), {}};
+        return std::bit_cast<F>(bits);
+    } else {
+        F p = 1;
+        for (; k > 0; k--) {
+            p *= 2;
+        }
+        for (; k < 0; k++) {
+            p /= 2;
+        }
+        return p;
+    }
+}
+
+// a_y * 2^a_n for 1/2 < a_y < 2. Results above the largest finite value become
+// inf; results below the normal range are formed in two steps so that the
+// subnormal result is rounded only once.
+template <typename F>
+constexpr inline F ScalePow2(F a_y, int a_n) {
+    constexpr int MaxExp = std::numeric_limits<F>::max_exponent - 1;
+    constexpr int MinExp = std::numeric_limits<F>::min_exponent - 1;
+    constexpr int Shift = std::numeric_limits<F>::digits + 2;
+    if (a_n > MaxExp) {
+        return a_y * Pow2<F>(MaxExp) * Pow2<F>(a_n - MaxExp);
+    }
+    if (a_n < MinExp) {
+        return a_y * Pow2<F>(a_n + Shift) * Pow2<F>(-Shift);
+    }
+    return a_y * Pow2<F>(a_n);
+}
+
+// a_n as the int exponent of ScalePow2, for the Modf reduction in constant
+// expressions where std::ldexp is not available: exponents far outside the
+// range of F give inf / 0 all the same and are clamped to where the Pow2
+// factors of ScalePow2 stay normal
+template <typename F>
+constexpr inline int ClampScaleExponent(F a_n) {
+    constexpr int MaxExp = std::numeric_limits<F>::max_exponent - 1;
+    constexpr int MinExp = std::numeric_limits<F>::min_exponent - 1;
+    constexpr int Shift = std::numeric_limits<F>::digits + 2;
+    if (a_n > static_cast<F>(2 * MaxExp)) {
+        return 2 * MaxExp;
+    }
+    if (a_n < static_cast<F>(MinExp - Shift)) {
+        return MinExp - Shift;
+    }
+    return static_cast<int>(a_n);
+}
+
+// r = x - n * ln2 for an integer n with |n| below 2^Ln2SplitBits<F>(), i.e.
+// for every n of an x in [ExpMin, ExpMax]: the products with all parts but
+// the last are exact, so is x - n * Ln2Parts[0] (x and n * ln2 are within a
+// factor of two), and the last product is folded in by an FMA where there is
+// one. The error is about |n| * 2^-(Parts * digits - (Parts - 1) * bits(n)),
+// far below an ulp of r, for any x of the range.
+template <typename F, int Parts = 2>
+constexpr inline F ReduceLn2(F a_x, F a_n) {
+    constexpr const std::array<F, Parts> &c = Ln2Parts<F, Parts>;
+    F r = a_x - a_n * c[0];
+    for (int p = 1; p < Parts; ++p) {
+        r = Fnma(a_n, c[p], r);
+    }
+    return r;
+}
+
+// x = n * ln2 + r, |r| <= ln2 / 2 (up to rounding) for ExpMin <= x <= ExpMax
+template <typename F>
+struct Reduced {
+    F n;
+    F r;
+};
+
+// TwoStep = false subtracts n * Ln2<F>() at once, which costs up to
+// OneStepReductionError<F>() of relative accuracy
+template <typename F, bool TwoStep = true>
+constexpr inline Reduced<F> ReduceCodyWaite(F a_x) {
+    F n = (a_x * Log2E<F>() + RoundMagic<F>()) - RoundMagic<F>();
+    if constexpr (!TwoStep) {
+        return {n, a_x - n * Ln2<F>()};
+    }
+    return {n, ReduceLn2<F, 2>(a_x, n)};
+}
+
+// 64 bits of TwoOverPiBits from bit a_pos on (bit 0 weighs 2^-1); bits before
+// the binary point (a_pos < 0) and past the table read as 0
+inline uint64_t TwoOverPiWord(int a_pos) {
+    auto word = [](int w) -> uint64_t {
+        return w >= 0 && w < static_cast<int>(TwoOverPiBits.size()) ? TwoOverPiBits[w]
+                                                                     : 0;
+    };
+    int w = a_pos >> 6;  // floor, also for a_pos < 0
+    int b = a_pos & 63;
+    uint64_t hi = word(w);
+    return b == 0 ? hi : hi << b | word(w + 1) >> (64 - b);
+}
+
+// x = (4j + quadrant) * pi / 2 + r, |r| <= pi / 4
+template <typename F>
+struct ReducedPiOver2 {
+    int quadrant;
+    F r;
+};
+
+// Payne-Hanek reduction for any finite x, meant for |x| >= PiOver2SplitMax
+// where the products with the Cody-Waite split are no longer exact. With
+// |x| = m * 2^s, m an integer of digits bits, the bits of 2 / pi that only add
+// multiples of 4 to x * 2 / pi are skipped and the next 256 are multiplied in,
+// so the fraction is exact to about 2^(digits - 254), far below the closest
+// any F comes to a multiple of pi / 2. r = f * pi / 2 is then formed in long
+// double.
+template <typename F>
+inline ReducedPiOver2<F> ReducePiOver2Large(F a_x) {
+    constexpr int Digits = std::numeric_limits<F>::digits;
+    static_assert(Digits <= 64);
+    using U128 = unsigned __int128;
+    constexpr uint64_t Half = uint64_t(1) << 61;  // 2^253 in the top word
+
+    int e = 0;
+    F mant = std::frexp(a_x < 0 ? -a_x : a_x, &e);
+    auto m = static_cast<uint64_t>(std::ldexp(mant, Digits));  // exact
+    int p = e - Digits - 2;  // bits of 2 / pi before p add multiples of 4
+
+    // q = m * (256 bits of 2 / pi from p) mod 2^256, i.e. (|x| * 2 / pi mod 4)
+    // in units of 2^-254, least significant word first
+    std::array<uint64_t, 4> q = {};
+    uint64_t carry = 0;
+    for (int k = 0; k < 3; ++k) {
+        U128 t = static_cast<U128>(m) * TwoOverPiWord(p + 192 - 64 * k) + carry;
+        q[k] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+    }
+    q[3] = m * TwoOverPiWord(p) + carry;
+
+    // round to the nearest quadrant, then |f| * 2^254 = |q - 2^253| over the
+    // low 254 bits
+    q[3] += Half;
+    int quadrant = static_cast<int>(q[3] >> 62);
+    q[3] &= (uint64_t(1) << 62) - 1;
+    bool negative = q[3] < Half;
+    std::array<uint64_t, 4> a = q, b = {0, 0, 0, Half};
+    if (negative) {
+        std::swap(a, b);
+    }
+    uint64_t borrow = 0;
+    for (int k = 0; k < 4; ++k) {
+        uint64_t d = a[k] - b[k] - borrow;
+        borrow = a[k] < b[k] || (a[k] == b[k] && borrow) ? 1 : 0;
+        a[k] = d;
+    }
+    long double f = std::ldexp(static_cast<long double>(a[0]), -254);
+    f += std::ldexp(static_cast<long double>(a[1]), -190);
+    f += std::ldexp(static_cast<long double>(a[2]), -126);
+    f += std::ldexp(static_cast<long double>(a[3]), -62);  // |f| <= 1/2
+
+    // pi / 2 = P1 + P2 from the three-part split
+    constexpr long double P1 = PiOver2Hi<long double>() + PiOver2Mid<long double>();
+    constexpr long double P2 = (PiOver2Hi<long double>() - P1) +
+                               PiOver2Mid<long double>() + PiOver2Lo<long double>();
+    auto r = static_cast<F>(f * P1 + f * P2);
+    if (negative) {
+        r = -r;
+    }
+    if (a_x < 0) {
+        return {(4 - quadrant) & 3, -r};
+    }
+    return {quadrant, r};
+}
+
+// |n| <= -ExpMin * log2 e; ln2 rounded to F and the rounded product n * ln2
+// each add about |n| * Eps<F> / 2 of absolute error to r
+template <typename F>
+constexpr inline long double OneStepReductionError() {
+    return -static_cast<long double>(ExpMin<F>()) * Log2E<long double>() * Eps<F>;
+}
+
+}  // namespace ADAAI
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "constants.hpp"
+
+namespace ADAAI {
+
+// Offline Remez exchange: the polynomial p of a given degree minimizing the
+// relative error max |p(x) / f(x) - 1| on [a, b]. Real is the working
+// precision (long double, __float128, ...); Func maps Real to Real.
+//
+// With unit_c0 the constant term is pinned, p(x) = 1 + x q(x), so that p(0) = 1
+// exactly whatever the rounding of the other coefficients (f(0) = 1 and
+// a < 0 < b are assumed). The error then vanishes at 0, and it is
+// (p - f) / f * sign(x), continuous through 0, that equioscillates.
+
+template <typename Real>
+struct MinimaxResult {
+    std::vector<Real> coef;  // coef[k] multiplies x^k
+    Real error;              // max |p(x) / f(x) - 1| over [a, b]
+    int iterations;
+};
+
+// Gaussian elimination with partial pivoting
+template <typename Real>
+std::vector<Real> solveLinear(std::vector<std::vector<Real>> A, std::vector<Real> b) {
+    const size_t n = b.size();
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; ++i) {
+            if (Abs(A[i][k]) > Abs(A[pivot][k])) {
+                pivot = i;
+            }
+        }
+        if (A[pivot][k] == 0) {
+            throw std::runtime_error("remez: singular system");
+        }
+        std::swap(A[k], A[pivot]);
+        std::swap(b[k], b[pivot]);
+        for (size_t i = k + 1; i < n; ++i) {
+            Real m = A[i][k] / A[k][k];
+            for (size_t j = k; j < n; ++j) {
+                A[i][j] -= m * A[k][j];
+            }
+            b[i] -= m * b[k];
+        }
+    }
+    std::vector<Real> x(n);
+    for (size_t i = n; i-- > 0;) {
+        Real s = b[i];
+        for (size_t j = i + 1; j < n; ++j) {
+            s -= A[i][j] * x[j];
+        }
+        x[i] = s / A[i][i];
+    }
+    return x;
+}
+
+template <typename Real, typename Func>
+MinimaxResult<Real> remez(
+    Func f,
+    Real a,
+    Real b,
+    int degree,
+    int max_iter = 64,
+    bool unit_c0 = false
+) {
+    const int k0 = unit_c0 ? 1 : 0;  // first free coefficient
+    const int n = degree + 2 - k0;   // size of the reference (alternation) set
+    MinimaxResult<Real> res{std::vector<Real>(degree + 1), 0, 0};
+    res.coef[0] = 1;
+
+    auto relErr = [&](Real x) {
+        Real p = res.coef[degree];
+        for (int k = degree - 1; k >= 0; --k) {
+            p = p * x + res.coef[k];
+        }
+        return p / f(x) - 1;
+    };
+    // the function that alternates in sign over the reference
+    auto altErr = [&](Real x) { return unit_c0 && x < 0 ? -relErr(x) : relErr(x); };
+
+    // start from the degree + 2 Chebyshev extrema, ascending; a pinned c0 drops
+    // the middle one, where the error is forced to 0
+    std::vector<Real> ref;
+    for (int i = 0; i < degree + 2; ++i) {
+        if (unit_c0 && i == (degree + 2) / 2) {
+            continue;
+        }
+        long double c = std::cos(PI<long double>() * i / (degree + 1));
+        ref.push_back((a + b) / 2 - (b - a) / 2 * static_cast<Real>(c));
+    }
+
+    for (res.iterations = 1; res.iterations <= max_iter; ++res.iterations) {
+        // p(x_i) - f(x_i) = (-1)^i E f(x_i) for c_0..c_degree and E; with a
+        // pinned c0 = 1 the unknowns are c_1..c_degree and E, the right-hand
+        // side is f(x_i) - 1 and the error term carries sign(x_i)
+        std::vector<std::vector<Real>> A(n, std::vector<Real>(n));
+        std::vector<Real> rhs(n);
+        for (int i = 0; i < n; ++i) {
+            Real fx = f(ref[i]);
+            Real pw = unit_c0 ? ref[i] : 1;
+            for (int j = k0; j <= degree; ++j) {
+                A[i][j - k0] = pw;
+                pw *= ref[i];
+            }
+            Real e = (i % 2 == 0 ? -fx : fx);
+            A[i][n - 1] = unit_c0 && ref[i] < 0 ? -e : e;
+            rhs[i] = unit_c0 ? fx - 1 : fx;
+        }
+        std::vector<Real> sol = solveLinear(A, rhs);
+        for (int j = k0; j <= degree; ++j) {
+            res.coef[j] = sol[j - k0];
+        }
+
+        // the error changes sign between consecutive reference points:
+        // bisect for the zeros, they bound the intervals of the new extrema
+        std::vector<Real> z(n + 1);
+        z[0] = a;
+        z[n] = b;
+        for (int i = 0; i + 1 < n; ++i) {
+            Real lo = ref[i], hi = ref[i + 1];
+            Real elo = altErr(lo);
+            for (int it = 0; it < 160 && lo < hi; ++it) {
+                Real mid = (lo + hi) / 2;
+                if (mid == lo || mid == hi) {
+                    break;
+                }
+                Real em = altErr(mid);
+                if ((em < 0) == (elo < 0)) {
+                    lo = mid, elo = em;
+                } else {
+                    hi = mid;
+                }
+            }
+            z[i + 1] = (lo + hi) / 2;
+        }
+
+        // new reference: argmax |error| on every [z_i, z_{i+1}], coarse scan
+        // followed by golden-section refinement around the best sample
+        Real emax = 0, emin = -1;
+        for (int i = 0; i < n; ++i) {
+            const int samples = 64;
+            Real step = (z[i + 1] - z[i]) / samples;
+            Real best = z[i];
+            for (int s = 0; s <= samples; ++s) {
+                Real x = z[i] + step * s;
+                if (Abs(relErr(x)) > Abs(relErr(best))) {
+                    best = x;
+                }
+            }
+            Real lo = best - step < z[i] ? z[i] : best - step;
+            Real hi = best + step > z[i + 1] ? z[i + 1] : best + step;
+            const Real g = static_cast<Real>(0.6180339887498948482045868343656381L);
+            for (int it = 0; it < 200 && hi - lo > 0; ++it) {
+                Real x1 = hi - g * (hi - lo), x2 = lo + g * (hi - lo);
+                if (x1 >= x2) {
+                    break;
+                }
+                if (Abs(relErr(x1)) > Abs(relErr(x2))) {
+                    hi = x2;
+                } else {
+                    lo = x1;
+                }
+            }
+            Real cand = (lo + hi) / 2;
+            ref[i] = Abs(relErr(cand)) >= Abs(relErr(best)) ? cand : best;
+
+            Real e = Abs(relErr(ref[i]));
+            emax = e > emax ? e : emax;
+            emin = (emin < 0 || e < emin) ? e : emin;
+        }
+        res.error = emax;
+
+        // equioscillation up to a relative spread of 1e-6
+        if (emax - emin <= emax * static_cast<Real>(1e-6)) {
+            break;
+        }
+    }
+    return res;
+}
+
+}  // namespace ADAAI
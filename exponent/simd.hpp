@@ -0,0 +1,599 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "constants.hpp"
+#include "eft.hpp"
+#include "reduction.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ADAAI_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define ADAAI_SIMD_X86 0
+#endif
+
+// Functions defined between ADAAI_TARGET_BEGIN(isa) and ADAAI_TARGET_END,
+// templates included, are compiled for the given instruction set regardless of
+// the global -m flags; they must only be called after detectIsa() allows it.
+#define ADAAI_PRAGMA(x) _Pragma(#x)
+#if defined(__clang__)
+#define ADAAI_TARGET_BEGIN(isa) \
+    ADAAI_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+#define ADAAI_TARGET_END ADAAI_PRAGMA(clang attribute pop)
+#else
+#define ADAAI_TARGET_BEGIN(isa) ADAAI_PRAGMA(GCC push_options) ADAAI_PRAGMA(GCC target(isa))
+#define ADAAI_TARGET_END ADAAI_PRAGMA(GCC pop_options)
+#endif
+
+namespace ADAAI::simd {
+
+enum class Isa { Scalar, Avx2, Avx512 };
+
+// widest instruction set the kernels may use on this CPU, detected once
+inline Isa detectIsa() {
+#if ADAAI_SIMD_X86
+    static const Isa isa = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return Isa::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return Isa::Avx2;
+        }
+        return Isa::Scalar;
+    }();
+    return isa;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+// ======================= ISA TRAITS =======================
+// Every traits type exposes the same vocabulary so that one kernel source
+// (simd_kernels.inc) serves all instruction sets:
+//   V, Width, load, store, set1, add, sub, mul, div, fma (a * b + c),
+//   fms (a * b - c), fnma (c - a * b), min, max (x86 operand order: a NaN
+//   in b is returned), round (to nearest even), scale (p * 2^n for integral n),
+//   M (a lane mask), lt, eq (ordered: false for NaN), select (m ? a : b),
+//   logb (floor(log2 a)) and mant (a / 2^logb(a) in [1, 2)) for finite a > 0,
+//   subnormals included.
+// fma and fms round once on the vector ISAs, so TwoProd can be built on them;
+// Scalar's do so only where the compiler reports a fast fma.
+
+template <typename F>
+struct Scalar {
+    using V = F;
+    using M = bool;
+    using Bits = std::conditional_t<sizeof(F) == 8, uint64_t, uint32_t>;
+    static constexpr size_t Width = 1;
+    static constexpr int Mantissa = std::numeric_limits<F>::digits - 1;
+    static constexpr int Bias = std::numeric_limits<F>::max_exponent - 1;
+
+    static V load(const F *p) {
+        return *p;
+    }
+
+    static void store(F *p, V v) {
+        *p = v;
+    }
+
+    static V set1(F a) {
+        return a;
+    }
+
+    static V add(V a, V b) {
+        return a + b;
+    }
+
+    static V sub(V a, V b) {
+        return a - b;
+    }
+
+    static V mul(V a, V b) {
+        return a * b;
+    }
+
+    static V div(V a, V b) {
+        return a / b;
+    }
+
+    static V fma(V a, V b, V c) {
+#if defined(FP_FAST_FMA)
+        return std::fma(a, b, c);
+#else
+        return a * b + c;
+#endif
+    }
+
+    static V fms(V a, V b, V c) {
+        return fma(a, b, -c);
+    }
+
+    static V fnma(V a, V b, V c) {
+        return fma(-a, b, c);
+    }
+
+    static V min(V a, V b) {
+        return a < b ? a : b;
+    }
+
+    static V max(V a, V b) {
+        return a > b ? a : b;
+    }
+
+    static M lt(V a, V b) {
+        return a < b;
+    }
+
+    static M eq(V a, V b) {
+        return a == b;
+    }
+
+    static V select(M m, V a, V b) {
+        return m ? a : b;
+    }
+
+    static V logb(V a) {
+        return std::logb(a);
+    }
+
+    static V mant(V a) {
+        int e = 0;
+        return 2 * std::frexp(a, &e);
+    }
+
+    // round-to-nearest magic constant: valid for |a| < 2^(Mantissa - 1)
+    static V round(V a) {
+        constexpr F magic = static_cast<F>(3) * static_cast<F>(Bits(1) << (Mantissa - 1));
+        return (a + magic) - magic;
+    }
+
+    // 2^n for integral n in the normal exponent range, built in the exponent
+    // field: the low bits of n + (2^Mantissa + Bias) hold n + Bias
+    static V pow2(V n) {
+        constexpr F magic = static_cast<F>(Bits(1) << Mantissa) + Bias;
+        return std::bit_cast<F>(std::bit_cast<Bits>(n + magic) << Mantissa);
+    }
+
+    // two steps so that both halves stay normal while the product may
+    // overflow to inf or round into the subnormal range exactly once
+    static V scale(V p, V n) {
+        V n1 = round(n * static_cast<F>(0.5));
+        return p * pow2(n1) * pow2(n - n1);
+    }
+};
+
+#if ADAAI_SIMD_X86
+
+ADAAI_TARGET_BEGIN("avx2,fma")
+
+template <typename F>
+struct Avx2;
+
+template <>
+struct Avx2<double> {
+    using V = __m256d;
+    using M = V;
+    static constexpr size_t Width = 4;
+
+    static V load(const double *p) {
+        return _mm256_loadu_pd(p);
+    }
+
+    static void store(double *p, V v) {
+        _mm256_storeu_pd(p, v);
+    }
+
+    static V set1(double a) {
+        return _mm256_set1_pd(a);
+    }
+
+    static V add(V a, V b) {
+        return _mm256_add_pd(a, b);
+    }
+
+    static V sub(V a, V b) {
+        return _mm256_sub_pd(a, b);
+    }
+
+    static V mul(V a, V b) {
+        return _mm256_mul_pd(a, b);
+    }
+
+    static V div(V a, V b) {
+        return _mm256_div_pd(a, b);
+    }
+
+    static V fma(V a, V b, V c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+
+    static V fms(V a, V b, V c) {
+        return _mm256_fmsub_pd(a, b, c);
+    }
+
+    static V fnma(V a, V b, V c) {
+        return _mm256_fnmadd_pd(a, b, c);
+    }
+
+    static V min(V a, V b) {
+        return _mm256_min_pd(a, b);
+    }
+
+    static V max(V a, V b) {
+        return _mm256_max_pd(a, b);
+    }
+
+    static M lt(V a, V b) {
+        return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+    }
+
+    static M eq(V a, V b) {
+        return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+    }
+
+    static V select(M m, V a, V b) {
+        return _mm256_blendv_pd(b, a, m);
+    }
+
+    static V logb(V a) {
+        M tiny = lt(a, set1(std::numeric_limits<double>::min()));
+        V t = select(tiny, mul(a, set1(0x1.0p52)), a);
+        __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(t), 52);
+        V magic = set1(0x1.0p52);
+        __m256i biased = _mm256_or_si256(e, _mm256_castpd_si256(magic));
+        V n = sub(_mm256_castsi256_pd(biased), magic);
+        return sub(n, select(tiny, set1(1023 + 52), set1(1023)));
+    }
+
+    static V mant(V a) {
+        M tiny = lt(a, set1(std::numeric_limits<double>::min()));
+        __m256i t = _mm256_castpd_si256(select(tiny, mul(a, set1(0x1.0p52)), a));
+        __m256i bits = _mm256_and_si256(t, _mm256_set1_epi64x(0x000fffffffffffff));
+        __m256i one = _mm256_castpd_si256(set1(1.0));
+        return _mm256_castsi256_pd(_mm256_or_si256(bits, one));
+    }
+
+    static V round(V a) {
+        return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    static V pow2(V n) {
+        __m256i bits = _mm256_castpd_si256(_mm256_add_pd(n, set1(0x1.0p52 + 1023)));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(bits, 52));
+    }
+
+    static V scale(V p, V n) {
+        V n1 = round(mul(n, set1(0.5)));
+        return mul(mul(p, pow2(n1)), pow2(sub(n, n1)));
+    }
+};
+
+template <>
+struct Avx2<float> {
+    using V = __m256;
+    using M = V;
+    static constexpr size_t Width = 8;
+
+    static V load(const float *p) {
+        return _mm256_loadu_ps(p);
+    }
+
+    static void store(float *p, V v) {
+        _mm256_storeu_ps(p, v);
+    }
+
+    static V set1(float a) {
+        return _mm256_set1_ps(a);
+    }
+
+    static V add(V a, V b) {
+        return _mm256_add_ps(a, b);
+    }
+
+    static V sub(V a, V b) {
+        return _mm256_sub_ps(a, b);
+    }
+
+    static V mul(V a, V b) {
+        return _mm256_mul_ps(a, b);
+    }
+
+    static V div(V a, V b) {
+        return _mm256_div_ps(a, b);
+    }
+
+    static V fma(V a, V b, V c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+
+    static V fms(V a, V b, V c) {
+        return _mm256_fmsub_ps(a, b, c);
+    }
+
+    static V fnma(V a, V b, V c) {
+        return _mm256_fnmadd_ps(a, b, c);
+    }
+
+    static V min(V a, V b) {
+        return _mm256_min_ps(a, b);
+    }
+
+    static V max(V a, V b) {
+        return _mm256_max_ps(a, b);
+    }
+
+    static M lt(V a, V b) {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+
+    static M eq(V a, V b) {
+        return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+    }
+
+    static V select(M m, V a, V b) {
+        return _mm256_blendv_ps(b, a, m);
+    }
+
+    static V logb(V a) {
+        M tiny = lt(a, set1(std::numeric_limits<float>::min()));
+        V t = select(tiny, mul(a, set1(0x1.0p23f)), a);
+        V n = _mm256_cvtepi32_ps(_mm256_srli_epi32(_mm256_castps_si256(t), 23));
+        return sub(n, select(tiny, set1(127 + 23), set1(127)));
+    }
+
+    static V mant(V a) {
+        M tiny = lt(a, set1(std::numeric_limits<float>::min()));
+        __m256i t = _mm256_castps_si256(select(tiny, mul(a, set1(0x1.0p23f)), a));
+        __m256i bits = _mm256_and_si256(t, _mm256_set1_epi32(0x007fffff));
+        __m256i one = _mm256_castps_si256(set1(1.0f));
+        return _mm256_castsi256_ps(_mm256_or_si256(bits, one));
+    }
+
+    static V round(V a) {
+        return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    static V pow2(V n) {
+        __m256i bits = _mm256_castps_si256(_mm256_add_ps(n, set1(0x1.0p23f + 127)));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 23));
+    }
+
+    static V scale(V p, V n) {
+        V n1 = round(mul(n, set1(0.5f)));
+        return mul(mul(p, pow2(n1)), pow2(sub(n, n1)));
+    }
+};
+
+ADAAI_TARGET_END
+
+ADAAI_TARGET_BEGIN("avx512f")
+
+template <typename F>
+struct Avx512;
+
+template <>
+struct Avx512<double> {
+    using V = __m512d;
+    using M = __mmask8;
+    static constexpr size_t Width = 8;
+
+    static V load(const double *p) {
+        return _mm512_loadu_pd(p);
+    }
+
+    static void store(double *p, V v) {
+        _mm512_storeu_pd(p, v);
+    }
+
+    static V set1(double a) {
+        return _mm512_set1_pd(a);
+    }
+
+    static V add(V a, V b) {
+        return _mm512_add_pd(a, b);
+    }
+
+    static V sub(V a, V b) {
+        return _mm512_sub_pd(a, b);
+    }
+
+    static V mul(V a, V b) {
+        return _mm512_mul_pd(a, b);
+    }
+
+    static V div(V a, V b) {
+        return _mm512_div_pd(a, b);
+    }
+
+    static V fma(V a, V b, V c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+
+    static V fms(V a, V b, V c) {
+        return _mm512_fmsub_pd(a, b, c);
+    }
+
+    static V fnma(V a, V b, V c) {
+        return _mm512_fnmadd_pd(a, b, c);
+    }
+
+    static V min(V a, V b) {
+        return _mm512_min_pd(a, b);
+    }
+
+    static V max(V a, V b) {
+        return _mm512_max_pd(a, b);
+    }
+
+    static M lt(V a, V b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+    }
+
+    static M eq(V a, V b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+    }
+
+    static V select(M m, V a, V b) {
+        return _mm512_mask_blend_pd(m, b, a);
+    }
+
+    static V logb(V a) {
+        return _mm512_getexp_pd(a);
+    }
+
+    static V mant(V a) {
+        return _mm512_getmant_pd(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+    }
+
+    static V round(V a) {
+        return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    // vscalefpd handles overflow and subnormal results in one instruction
+    static V scale(V p, V n) {
+        return _mm512_scalef_pd(p, n);
+    }
+};
+
+template <>
+struct Avx512<float> {
+    using V = __m512;
+    using M = __mmask16;
+    static constexpr size_t Width = 16;
+
+    static V load(const float *p) {
+        return _mm512_loadu_ps(p);
+    }
+
+    static void store(float *p, V v) {
+        _mm512_storeu_ps(p, v);
+    }
+
+    static V set1(float a) {
+        return _mm512_set1_ps(a);
+    }
+
+    static V add(V a, V b) {
+        return _mm512_add_ps(a, b);
+    }
+
+    static V sub(V a, V b) {
+        return _mm512_sub_ps(a, b);
+    }
+
+    static V mul(V a, V b) {
+        return _mm512_mul_ps(a, b);
+    }
+
+    static V div(V a, V b) {
+        return _mm512_div_ps(a, b);
+    }
+
+    static V fma(V a, V b, V c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+
+    static V fms(V a, V b, V c) {
+        return _mm512_fmsub_ps(a, b, c);
+    }
+
+    static V fnma(V a, V b, V c) {
+        return _mm512_fnmadd_ps(a, b, c);
+    }
+
+    static V min(V a, V b) {
+        return _mm512_min_ps(a, b);
+    }
+
+    static V max(V a, V b) {
+        return _mm512_max_ps(a, b);
+    }
+
+    static M lt(V a, V b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+
+    static M eq(V a, V b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+    }
+
+    static V select(M m, V a, V b) {
+        return _mm512_mask_blend_ps(m, b, a);
+    }
+
+    static V logb(V a) {
+        return _mm512_getexp_ps(a);
+    }
+
+    static V mant(V a) {
+        return _mm512_getmant_ps(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+    }
+
+    static V round(V a) {
+        return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    static V scale(V p, V n) {
+        return _mm512_scalef_ps(p, n);
+    }
+};
+
+ADAAI_TARGET_END
+
+#endif  // ADAAI_SIMD_X86
+
+// ======================= PER-ISA KERNELS =======================
+
+namespace scalar {
+template <typename F>
+using Vec = Scalar<F>;
+#include "simd_kernels.inc"
+}  // namespace scalar
+
+#if ADAAI_SIMD_X86
+
+ADAAI_TARGET_BEGIN("avx2,fma")
+namespace avx2 {
+template <typename F>
+using Vec = Avx2<F>;
+#include "simd_kernels.inc"
+}  // namespace avx2
+ADAAI_TARGET_END
+
+ADAAI_TARGET_BEGIN("avx512f")
+namespace avx512 {
+template <typename F>
+using Vec = Avx512<F>;
+#include "simd_kernels.inc"
+}  // namespace avx512
+ADAAI_TARGET_END
+
+#endif  // ADAAI_SIMD_X86
+
+// calls body(K{}) with the Kernels struct of the requested instruction set,
+// capped at what detectIsa() reports
+template <typename Body>
+inline void dispatch(Isa isa, Body &&body) {
+    if (isa > detectIsa()) {
+        isa = detectIsa();
+    }
+#if ADAAI_SIMD_X86
+    if (isa == Isa::Avx512) {
+        body(avx512::Kernels{});
+        return;
+    }
+    if (isa == Isa::Avx2) {
+        body(avx2::Kernels{});
+        return;
+    }
+#endif
+    body(scalar::Kernels{});
+}
+
+}  // namespace ADAAI::simd
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include "elementary.hpp"
+#include "simd.hpp"
+
+namespace ADAAI {
+
+// log(sum exp(x_i)) and softmax over float / double arrays on the vector exp
+// kernel of ExpN, without a scalar Exp call per element and without an array
+// of intermediate exponentials: one pass finds m = max x_i, a second sums
+// exp(x_i - m) <= 1, so nothing overflows and the largest term is exactly 1.
+// Dispatched like ExpN. Compensated = true carries the rounding errors of the
+// sum along (TwoSum per lane), which matters for long inputs in float.
+
+// max in[i], -inf for an empty input, NaN if any input is NaN
+template <typename F>
+F MaxN(std::span<const F> in, simd::Isa isa = simd::detectIsa()) {
+    const F *x = in.data();
+    const size_t n = in.size();
+    F m = -std::numeric_limits<F>::infinity();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template maxArray<F>(x, n, m);
+    });
+    simd::scalar::Kernels::maxArray<F>(x + done, n - done, m);
+    return m;
+}
+
+// sum of exp(in[i] - a_shift), each term also stored to a_out unless it is
+// nullptr
+template <typename F, bool Compensated = false>
+F ExpSumN(
+    std::span<const F> in,
+    F *a_out,
+    F a_shift,
+    simd::Isa isa = simd::detectIsa()
+) {
+    const F *x = in.data();
+    const size_t n = in.size();
+    F sum = 0, err = 0;
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template expSumArray<F, Compensated>(
+            x, a_out, a_shift, n, sum, err
+        );
+    });
+    simd::scalar::Kernels::expSumArray<F, Compensated>(
+        x + done, a_out ? a_out + done : nullptr, a_shift, n - done, sum, err
+    );
+    return sum + err;
+}
+
+// log(sum_i exp(in[i])); -inf for an empty input or all -inf, +inf if any
+// input is +inf, NaN if any is NaN
+template <typename F, bool Compensated = false>
+F LogSumExp(std::span<const F> in, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    F m = MaxN(in, isa);
+    if (m != m || std::isinf(m)) {
+        return m;
+    }
+    return m + Log(ExpSumN<F, Compensated>(in, nullptr, m, isa));
+}
+
+// out[i] = exp(in[i]) / sum_j exp(in[j]); out may alias in. The exponentials
+// are written once and scaled in place, three streaming passes in all. An
+// input of +inf, or one of all -inf, gives NaN.
+template <typename F, bool Compensated = false>
+void Softmax(std::span<const F> in, std::span<F> out, simd::Isa isa = simd::detectIsa()) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    assert(out.size() >= in.size());
+
+    F m = MaxN(in, isa);
+    F sum = ExpSumN<F, Compensated>(in, out.data(), std::isinf(m) ? 0 : m, isa);
+    F inv = 1 / sum;
+
+    F *y = out.data();
+    const size_t n = in.size();
+    size_t done = 0;
+    simd::dispatch(isa, [&](auto kernels) {
+        done = decltype(kernels)::template scaleArray<F>(y, inv, n);
+    });
+    simd::scalar::Kernels::scaleArray<F>(y + done, inv, n - done);
+}
+
+}  // namespace ADAAI
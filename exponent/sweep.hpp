@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ADAAI {
+
+// Accuracy sweep of several Exp methods over x_i = a_l + i * a_step in one
+// pass. The points are cut into fixed chunks that threads take from a shared
+// counter; every chunk has its own accumulators, which are merged in chunk
+// order, so the result (argmax included) does not depend on the number of
+// threads. Points are generated from their index, not by repeated addition,
+// so every chunk can start on its own.
+
+// errors of one method as makeTests measures them: absolute for x < 0,
+// relative for x >= 0, each with the first x where the maximum is reached
+template <typename F>
+struct SweepError {
+    F max_abs = 0;
+    F argmax_abs = 0;
+    F max_rel = 0;
+    F argmax_rel = 0;
+    size_t count = 0;
+
+    void add(F a_x, F a_y, F a_ref) {
+        F diff = std::abs(a_ref - a_y);
+        if (a_x < 0) {
+            if (diff > max_abs) {
+                max_abs = diff, argmax_abs = a_x;
+            }
+        } else if (diff / a_ref > max_rel) {
+            max_rel = diff / a_ref, argmax_rel = a_x;
+        }
+        count++;
+    }
+
+    // a_other must come from later points: ties keep the earlier x
+    void merge(const SweepError &a_other) {
+        if (a_other.max_abs > max_abs) {
+            max_abs = a_other.max_abs, argmax_abs = a_other.argmax_abs;
+        }
+        if (a_other.max_rel > max_rel) {
+            max_rel = a_other.max_rel, argmax_rel = a_other.argmax_rel;
+        }
+        count += a_other.count;
+    }
+};
+
+// a method under test: y[i] = exp(x[i]), i < n, for a block of points
+template <typename F>
+struct SweepMethod {
+    std::string name;
+    std::function<void(const F *, F *, size_t)> exp;
+};
+
+// a block kernel from a scalar exp; a_fn is called directly, so the
+// std::function indirection is paid once per block, not per point
+template <typename F, typename Fn>
+SweepMethod<F> sweepMethod(std::string a_name, Fn a_fn) {
+    return {std::move(a_name), [a_fn](const F *x, F *y, size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    y[i] = a_fn(x[i]);
+                }
+            }};
+}
+
+// errors of every method of a_methods over [a_l, a_r] in steps of a_step,
+// on a_threads threads (0: one per hardware thread)
+template <typename F>
+std::vector<SweepError<F>> sweep(
+    F a_l,
+    F a_r,
+    F a_step,
+    const std::vector<SweepMethod<F>> &a_methods,
+    unsigned a_threads = 0
+) {
+    constexpr size_t ChunkPoints = 1024;
+    constexpr size_t Block = 256;
+
+    size_t points = 0;
+    if (a_l <= a_r) {
+        points = static_cast<size_t>(std::floor((a_r - a_l) / a_step)) + 1;
+        // the division may round up past the last point that is <= a_r
+        while (points > 0 && a_l + static_cast<F>(points - 1) * a_step > a_r) {
+            points--;
+        }
+    }
+    const size_t chunks = (points + ChunkPoints - 1) / ChunkPoints;
+    std::vector<std::vector<SweepError<F>>> stats(
+        chunks, std::vector<SweepError<F>>(a_methods.size())
+    );
+
+    auto sweepChunk = [&](size_t a_chunk) {
+        F x[Block], y[Block], ref[Block];
+        size_t end = std::min(points, (a_chunk + 1) * ChunkPoints);
+        for (size_t i = a_chunk * ChunkPoints; i < end;) {
+            size_t n = 0;
+            for (; n < Block && i < end; ++n, ++i) {
+                x[n] = a_l + static_cast<F>(i) * a_step;
+                ref[n] = std::exp(x[n]);
+            }
+            for (size_t m = 0; m < a_methods.size(); ++m) {
+                a_methods[m].exp(x, y, n);
+                for (size_t k = 0; k < n; ++k) {
+                    stats[a_chunk][m].add(x[k], y[k], ref[k]);
+                }
+            }
+        }
+    };
+
+    unsigned threads = a_threads ? a_threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::min<size_t>(std::max(threads, 1u), chunks));
+    std::atomic<size_t> next = 0;
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            for (size_t c; (c = next++) < chunks;) {
+                sweepChunk(c);
+            }
+        });
+    }
+    for (std::thread &t : pool) {
+        t.join();
+    }
+
+    std::vector<SweepError<F>> total(a_methods.size());
+    for (size_t c = 0; c < chunks; ++c) {
+        for (size_t m = 0; m < a_methods.size(); ++m) {
+            total[m].merge(stats[c][m]);
+        }
+    }
+    return total;
+}
+
+}  // namespace ADAAI
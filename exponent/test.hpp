@@ -1,8 +1,21 @@
 #pragma once
 
 #include <cmath>
+#include <filesystem>
 #include <functional>
+#include <iomanip>
+#include <limits>
+#include "coef_store.hpp"
+#include "dd.hpp"
+#include "dual.hpp"
+#include "elementary.hpp"
 #include "exp.hpp"
+#include "exp_simd.hpp"
+#include "softmax.hpp"
+#include "sweep.hpp"
+#ifdef ADAAI_HAVE_GSL
+#include "gsl_coef.hpp"
+#endif
 
 namespace ADAAI {
 template <typename T>
@@ -11,8 +24,8 @@ std::pair<T, T> makeTests(
     T a_l,
     T a_r,
     T a_step,
-    std::function<T(T, std::vector<T> *)> a_exponent,
-    std::vector<T> *coefs_fft = nullptr
+    std::function<T(T, std::span<const T>)> a_exponent,
+    std::span<const T> coefs_fft = {}
 ) {
     T currentX = a_l;
     T absError = 0.0;
@@ -31,50 +44,537 @@ std::pair<T, T> makeTests(
     return std::make_pair(absError, relError);
 }
 
+template <typename T>
+// the same max errors for the array API ExpN over the same points
+std::pair<T, T> makeTestsN(T a_l, T a_r, T a_step) {
+    std::vector<T> xs;
+    for (T currentX = a_l; currentX <= a_r; currentX += a_step) {
+        xs.push_back(currentX);
+    }
+    std::vector<T> ys(xs.size());
+    ExpN<T>(xs, ys);
+
+    T absError = 0.0;
+    T relError = 0.0;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        T stdExp = std::exp(xs[i]);
+        T diff = std::abs(stdExp - ys[i]);
+        if (xs[i] < 0) {
+            absError = std::max(diff, absError);
+        } else {
+            relError = std::max(diff / stdExp, relError);
+        }
+    }
+    return std::make_pair(absError, relError);
+}
+
+template <typename T>
+// max error of a_f against a_ref over the points: relative, or absolute
+// where a_ref may cross zero
+T makeTestsElementary(
+    T a_l,
+    T a_r,
+    T a_step,
+    std::function<T(T)> a_f,
+    std::function<T(T)> a_ref,
+    bool a_relative = true
+) {
+    T error = 0.0;
+    for (T currentX = a_l; currentX <= a_r; currentX += a_step) {
+        T diff = std::abs(a_f(currentX) - a_ref(currentX));
+        error = std::max(a_relative ? diff / std::abs(a_ref(currentX)) : diff, error);
+    }
+    return error;
+}
+
+template <typename T>
+// the same for an array kernel a_fn(in, out)
+T makeTestsElementaryN(
+    T a_l,
+    T a_r,
+    T a_step,
+    std::function<void(std::span<const T>, std::span<T>)> a_fn,
+    std::function<T(T)> a_ref,
+    bool a_relative = true
+) {
+    std::vector<T> xs;
+    for (T currentX = a_l; currentX <= a_r; currentX += a_step) {
+        xs.push_back(currentX);
+    }
+    std::vector<T> ys(xs.size());
+    a_fn(xs, ys);
+    T error = 0.0;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        T diff = std::abs(ys[i] - a_ref(xs[i]));
+        error = std::max(a_relative ? diff / std::abs(a_ref(xs[i])) : diff, error);
+    }
+    return error;
+}
+
+// Exp in constant expressions: every method but Fourier under both reductions
+// against exp(x) to 30 digits (relative error in units of Eps<F>), and the
+// saturated / NaN branches
+template <typename F>
+constexpr bool constexprExpTests() {
+    constexpr std::pair<F, long double> Points[] = {
+        {-20.5, 1.25015286638674262893755311923E-9L},
+        {-1, 0.367879441171442321595523770161L},
+        {0, 1.0L},
+        {0.25, 1.28402541668774148407342056806L},
+        {1, 2.71828182845904523536028747135L},
+        {10.75, 46630.0284535243292133664707858L},
+    };
+    bool ok = true;
+    auto check = [&]<Method M, Reduction R>() {
+        // the Chebyshev series is the least accurate, about 50 Eps<F>
+        constexpr long double Ulps = M == Method::Chebyshev ? 64 : 16;
+        for (auto [x, ref] : Points) {
+            long double y = Exp<M, F, 32, Scheme::Horner, R>(x);
+            ok = ok && Abs(y - ref) <= Ulps * Eps<F> * ref;
+        }
+        constexpr F Huge = static_cast<F>(1e30);
+        ok = ok && Exp<M, F, 32, Scheme::Horner, R>(Huge) ==
+                       std::numeric_limits<F>::infinity();
+        ok = ok && Exp<M, F, 32, Scheme::Horner, R>(-Huge) == 0;
+        F nan = std::numeric_limits<F>::quiet_NaN();
+        F y = Exp<M, F, 32, Scheme::Horner, R>(nan);
+        ok = ok && y != y;
+    };
+    auto checkBoth = [&]<Method M>() {
+        check.template operator()<M, Reduction::Modf>();
+        check.template operator()<M, Reduction::CodyWaite>();
+    };
+    checkBoth.template operator()<Method::Taylor>();
+    checkBoth.template operator()<Method::Minimax>();
+    checkBoth.template operator()<Method::Pade>();
+    checkBoth.template operator()<Method::Chebyshev>();
+    checkBoth.template operator()<Method::Table>();
+    return ok;
+}
+
+static_assert(constexprExpTests<float>());
+static_assert(constexprExpTests<double>());
+static_assert(constexprExpTests<long double>());
+
 template <typename F>
 // wrapper for tests verbose
 void runTests(F a_l, F a_r, F a_step, const std::string &a_typename) {
     const size_t Capacity = 50;
 
     std::cout << "=== RESULTS FOR " << a_typename << " ===" << std::endl;
+#if ADAAI_EXP_INSTRUMENT
+    resetExpCounters();
+#endif
     std::cout << "=> EPS is set to be "
               << 10.0 * ADAAI::Eps<float> << std::endl;
     {
-        auto [absError, relError] =
-            makeTests<F>(a_l, a_r, a_step, Exp<Method::Taylor, F, Capacity>);
-        std::cout << "=> TAYLOR     | Max absolute error: " << absError
-                  << std::endl;
-        std::cout << "=> TAYLOR     | Max relative error: " << relError
-                  << std::endl;
+        // every method over the same points in one parallel pass
+        int N = 1023;
+        std::vector<F> coef_fft(N + 1, 0);
+        chebyshevGaussQuadrature(N, coef_fft);
+        std::vector<F> samples = fourierSamples(coef_fft);
+        std::vector<SweepMethod<F>> methods = {
+            sweepMethod<F>(
+                "TAYLOR", [](F x) { return Exp<Method::Taylor, F, Capacity>(x); }
+            ),
+            sweepMethod<F>(
+                "TAYLOR/CW",
+                [](F x) {
+                    return Exp<
+                        Method::Taylor, F, Capacity, Scheme::Horner,
+                        Reduction::CodyWaite>(x);
+                }
+            ),
+            sweepMethod<F>(
+                "MINIMAX", [](F x) { return Exp<Method::Minimax, F, Capacity>(x); }
+            ),
+            sweepMethod<F>("TOL 1E-6", [](F x) { return ExpTol<1e-6L>(x); }),
+            sweepMethod<F>("PADE", [](F x) { return Exp<Method::Pade, F, Capacity>(x); }),
+            sweepMethod<F>(
+                "CHEBYSHEV", [](F x) { return Exp<Method::Chebyshev, F, Capacity>(x); }
+            ),
+            sweepMethod<F>(
+                "TABLE", [](F x) { return Exp<Method::Table, F, Capacity>(x); }
+            ),
+            sweepMethod<F>(
+                "Fourier",
+                [&samples](F x) {
+                    return Exp<Method::Fourier, F, Capacity>(x, samples);
+                }
+            ),
+        };
+        std::vector<SweepError<F>> errors = sweep<F>(a_l, a_r, a_step, methods);
+        // the merge is in chunk order: any thread count gives the same report
+        std::vector<SweepError<F>> other = sweep<F>(a_l, a_r, a_step, methods, 7);
+        bool same = std::equal(
+            errors.begin(), errors.end(), other.begin(),
+            [](const SweepError<F> &a, const SweepError<F> &b) {
+                return a.max_abs == b.max_abs && a.argmax_abs == b.argmax_abs &&
+                       a.max_rel == b.max_rel && a.argmax_rel == b.argmax_rel &&
+                       a.count == b.count;
+            }
+        );
+        for (size_t m = 0; m < methods.size(); ++m) {
+            std::cout << "=> " << std::left << std::setw(11) << methods[m].name
+                      << std::right << "| Max absolute error: " << errors[m].max_abs
+                      << " at x = " << errors[m].argmax_abs << std::endl;
+            std::cout << "=> " << std::left << std::setw(11) << methods[m].name
+                      << std::right << "| Max relative error: " << errors[m].max_rel
+                      << " at x = " << errors[m].argmax_rel << std::endl;
+        }
+        std::cout << "=> SWEEP      | " << errors[0].count << " points, default pool and "
+                  << "7 threads " << (same ? "agree" : "DIFFER") << std::endl;
     }
+#if ADAAI_EXP_INSTRUMENT
     {
-        auto [absError, relError] =
-            makeTests<F>(a_l, a_r, a_step, Exp<Method::Pade, F, Capacity>);
-        std::cout << "=> PADE       | Max absolute error: " << absError
-                  << std::endl;
-        std::cout << "=> PADE       | Max relative error: " << relError
-                  << std::endl;
+        // both sweeps, summed over their exited worker threads
+        ExpCounters c = expCounters();
+        uint64_t saturated = c[ExpEvent::SaturateHigh] + c[ExpEvent::SaturateLow];
+        std::cout << "=> COUNTERS   | " << c[ExpEvent::Call] << " calls (Pade "
+                  << c.calls(Method::Pade) << "), fix-up +1 / -1: "
+                  << c[ExpEvent::FixUpUp] << " / " << c[ExpEvent::FixUpDown]
+                  << ", saturated: " << saturated
+                  << ", Fourier shifts: " << c[ExpEvent::FourierShift] << std::endl;
+    }
+#endif
+    {
+        // Q * T_N - P vanishes up to x^N, and (P * Q) / Q gives back P with a
+        // zero remainder; both are formed from the static-degree tables at
+        // compile time
+        constexpr int N = MKExpTaylorOrder<F>();
+        constexpr auto pade = PadeExp<F, N>;
+        auto maxAbs = [](const auto &a_poly) {
+            F res = 0;
+            for (F c : a_poly.coefficients) {
+                res = std::max(res, Abs(c));
+            }
+            return res;
+        };
+        constexpr StaticPoly<F, N> taylor(ExpTaylorCoef<F, N>());
+        constexpr auto order = (pade.den * taylor).template resize<N>() - pade.num;
+        constexpr auto division = (pade.num * pade.den).divide(pade.den);
+        std::cout << "=> PADE CHECK | [" << decltype(pade.num)::Degree << "/"
+                  << decltype(pade.den)::Degree << "] order conditions: " << maxAbs(order)
+                  << ", (P * Q) / Q - P: " << maxAbs(division.first - pade.num)
+                  << ", remainder: " << maxAbs(division.second) << std::endl;
+    }
+    {
+        // a table built by the compiler and the same values computed now
+        constexpr size_t N = 64;
+        constexpr F x0 = -30, step = 1;
+        constexpr auto table = tabulate<F, N>(x0, step, [](F x) {
+            return Exp<Method::Table, F, Capacity>(x);
+        });
+        volatile F start = x0;  // keeps the loop below at run time
+        size_t same = 0;
+        for (size_t i = 0; i < N; ++i) {
+            F x = start + static_cast<F>(i) * step;
+            same += Exp<Method::Table, F, Capacity>(x) == table[i];
+        }
+        std::cout << "=> CONSTEXPR  | compile-time table equals run-time Exp at " << same
+                  << " of " << N << " points" << std::endl;
     }
     {
-        auto [absError, relError] =
-            makeTests<F>(a_l, a_r, a_step, Exp<Method::Chebyshev, F, Capacity>);
-        std::cout << "=> CHEBYSHEV  | Max absolute error: " << absError
+        // the same samples through a coefficient file: built, mapped, compared
+        namespace fs = std::filesystem;
+        std::string path = (fs::temp_directory_path() /
+                            ("adaai-test-" + std::to_string(CoefTypeCode<F>()) + ".coef"))
+                               .string();
+        MappedCoefs<F> store = fourierSampleStore<F>(path, 1024);
+        std::vector<F> coef_fft(1024, 0);
+        chebyshevGaussQuadrature(1023, coef_fft);
+        std::vector<F> samples = fourierSamples(coef_fft);
+        bool same = std::equal(
+            samples.begin(), samples.end(), store.values().begin(), store.values().end()
+        );
+        auto [absError, relError] = makeTests<F>(
+            a_l, a_r, a_step, Exp<Method::Fourier, F, Capacity>, store.values()
+        );
+        std::cout << "=> COEF STORE | mapped samples " << (same ? "match" : "DIFFER")
+                  << ", max absolute / relative error: " << absError << " / "
+                  << relError << std::endl;
+        fs::remove(path);
+    }
+    if constexpr (!std::is_same_v<F, long double>) {
+        auto [absError, relError] = makeTestsN<F>(a_l, a_r, a_step);
+        std::cout << "=> SIMD       | Max absolute error: " << absError
                   << std::endl;
-        std::cout << "=> CHEBYSHEV  | Max relative error: " << relError
+        std::cout << "=> SIMD       | Max relative error: " << relError
                   << std::endl;
     }
     {
-        int N = 1023;
-        std::vector<F> coef_fft(N + 1, 0);
-        chebyshevGaussQuadrature(N, coef_fft);
-        auto [absError, relError] = makeTests<F>(
-            a_l, a_r, a_step, Exp<Method::Fourier, F, Capacity>, &coef_fft
+        // log is checked on exp(x), sin and cos by absolute error
+        auto logExp = [](F x) { return Log(std::exp(x)); };
+        auto stdLogExp = [](F x) { return std::log(std::exp(x)); };
+        F exp2Error = makeTestsElementary<F>(
+            a_l, a_r, a_step, Exp2<F>, [](F x) { return std::exp2(x); }
+        );
+        F expm1Error = makeTestsElementary<F>(
+            a_l, a_r, a_step, Expm1<F>, [](F x) { return std::expm1(x); }
+        );
+        F logError = makeTestsElementary<F>(a_l, a_r, a_step, logExp, stdLogExp);
+        F sinError = makeTestsElementary<F>(
+            a_l, a_r, a_step, [](F x) { return SinCos(x).first; },
+            [](F x) { return std::sin(x); }, false
+        );
+        F cosError = makeTestsElementary<F>(
+            a_l, a_r, a_step, [](F x) { return SinCos(x).second; },
+            [](F x) { return std::cos(x); }, false
+        );
+        std::cout << "=> EXP2       | Max relative error: " << exp2Error << std::endl;
+        std::cout << "=> EXPM1      | Max relative error: " << expm1Error << std::endl;
+        std::cout << "=> LOG        | Max relative error: " << logError << std::endl;
+        std::cout << "=> SIN / COS  | Max absolute error: " << sinError << " / "
+                  << cosError << std::endl;
+    }
+    if constexpr (!std::is_same_v<F, long double>) {
+        using Span = std::span<const F>;
+        F exp2Error = makeTestsElementaryN<F>(
+            a_l, a_r, a_step, [](Span x, std::span<F> y) { Exp2N<F>(x, y); },
+            [](F x) { return std::exp2(x); }
         );
-        std::cout << "=> Fourier    | Max absolute error: " << absError
+        F expm1Error = makeTestsElementaryN<F>(
+            a_l, a_r, a_step, [](Span x, std::span<F> y) { Expm1N<F>(x, y); },
+            [](F x) { return std::expm1(x); }
+        );
+        F logError = makeTestsElementaryN<F>(
+            a_l, a_r, a_step,
+            [](Span x, std::span<F> y) {
+                std::vector<F> e(x.size());
+                ExpN<F>(x, e);
+                LogN<F>(e, y);
+            },
+            [](F x) { return std::log(std::exp(x)); }
+        );
+        F sinError = makeTestsElementaryN<F>(
+            a_l, a_r, a_step,
+            [](Span x, std::span<F> y) {
+                std::vector<F> c(x.size());
+                SinCosN<F>(x, y, c);
+            },
+            [](F x) { return std::sin(x); }, false
+        );
+        std::cout << "=> SIMD ELEM  | Exp2 / Expm1 / Log rel, Sin abs: " << exp2Error
+                  << " / " << expm1Error << " / " << logError << ", " << sinError
                   << std::endl;
-        std::cout << "=> Fourier    | Max relative error: " << relError
+    }
+    {
+        // sin / cos past the limit of the pi / 2 split, up to the largest
+        // finite values (Payne-Hanek), and expm1 just below the overflow
+        // threshold, where 2^n alone is already inf
+        std::vector<F> large, nearMax;
+        for (int e = 12; e < std::numeric_limits<F>::max_exponent; e += 7) {
+            for (F m : {F(1), F(1.3), F(-1.7)}) {
+                large.push_back(std::ldexp(m, e));
+            }
+        }
+        const F top = std::log(std::numeric_limits<F>::max());
+        for (F x = top - 1; x < top; x += static_cast<F>(1.0 / 64)) {
+            nearMax.push_back(x);
+        }
+        F sinError = 0, cosError = 0, expm1Error = 0;
+        for (F x : large) {
+            auto [s, c] = SinCos(x);
+            sinError = std::max(std::abs(s - std::sin(x)), sinError);
+            cosError = std::max(std::abs(c - std::cos(x)), cosError);
+        }
+        for (F x : nearMax) {
+            F ref = std::expm1(x);
+            expm1Error = std::max(std::abs(Expm1(x) - ref) / ref, expm1Error);
+        }
+        std::cout << "=> LARGE ARGS | Sin / Cos abs: " << sinError << " / " << cosError
+                  << ", Expm1 near overflow rel: " << expm1Error;
+        if constexpr (!std::is_same_v<F, long double>) {
+            std::vector<F> s(large.size()), c(large.size()), y(nearMax.size());
+            SinCosN<F>(large, s, c);
+            Expm1N<F>(nearMax, y);
+            F sinNError = 0, expm1NError = 0;
+            for (size_t i = 0; i < large.size(); ++i) {
+                sinNError = std::max(std::abs(s[i] - std::sin(large[i])), sinNError);
+                sinNError = std::max(std::abs(c[i] - std::cos(large[i])), sinNError);
+            }
+            for (size_t i = 0; i < nearMax.size(); ++i) {
+                F ref = std::expm1(nearMax[i]);
+                expm1NError = std::max(std::abs(y[i] - ref) / ref, expm1NError);
+            }
+            std::cout << "; SinCosN abs: " << sinNError
+                      << ", Expm1N rel: " << expm1NError;
+        }
+        std::cout << std::endl;
+    }
+    if constexpr (!std::is_same_v<F, long double>) {
+        // the points shifted by 50 and repeated to 4099 entries, so that the
+        // sum is long and a plain exp(x_i) would overflow in float
+        std::vector<F> xs;
+        for (F currentX = a_l; currentX <= a_r; currentX += a_step) {
+            xs.push_back(currentX + 50);
+        }
+        for (size_t i = xs.size(); i < 4099; ++i) {
+            xs.push_back(xs[i % xs.size()]);
+        }
+        long double m = *std::max_element(xs.begin(), xs.end());
+        long double sum = 0;
+        for (F x : xs) {
+            sum += std::exp(static_cast<long double>(x) - m);
+        }
+        long double ref = m + std::log(sum);
+        F plain = LogSumExp<F>(xs);
+        F compensated = LogSumExp<F, true>(xs);
+
+        std::vector<F> ys(xs.size());
+        Softmax<F, true>(xs, ys);
+        long double softmaxError = 0, total = 0;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            long double p = std::exp(static_cast<long double>(xs[i]) - m) / sum;
+            softmaxError = std::max(std::abs(ys[i] - p) / p, softmaxError);
+            total += ys[i];
+        }
+        std::cout << "=> LSE        | Max relative error plain / compensated: "
+                  << std::abs(plain - ref) / ref << " / "
+                  << std::abs(compensated - ref) / ref << std::endl;
+        std::cout << "=> SOFTMAX    | Max relative error: " << softmaxError
+                  << ", sum - 1: " << total - 1 << std::endl;
+    }
+    if constexpr (!std::is_same_v<F, long double>) {
+        // -inf masks entries out; it must not poison the maximum. 37 entries
+        // put masked ones in the vector part and in the scalar tail
+        const F inf = std::numeric_limits<F>::infinity();
+        std::vector<F> xs(37), ys(37);
+        long double sum = 0;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            xs[i] = i % 3 == 0 ? -inf : static_cast<F>(i % 10);
+            sum += std::exp(static_cast<long double>(xs[i]) - 9);
+        }
+        long double ref = 9 + std::log(sum);
+        F masked = LogSumExp<F>(xs);
+        Softmax<F>(xs, ys);
+        long double softmaxError = 0;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            long double p = std::exp(static_cast<long double>(xs[i]) - 9) / sum;
+            softmaxError = std::max(std::abs(ys[i] - p), softmaxError);
+        }
+
+        std::vector<F> allMasked(37, -inf);
+        std::vector<F> withInf(37, 1), withNaN(37, 1);
+        withInf[20] = inf;
+        withNaN[33] = std::numeric_limits<F>::quiet_NaN();
+        std::cout << "=> LSE INF    | -inf masked: rel error "
+                  << std::abs(masked - ref) / ref << ", softmax abs error "
+                  << softmaxError << "; all -inf: " << LogSumExp<F>(allMasked)
+                  << ", with +inf: " << LogSumExp<F>(withInf)
+                  << ", with NaN: " << LogSumExp<F>(withNaN) << std::endl;
+    }
+    {
+        // f = exp(xy + x / 4) at (t, 1/2): value, gradient and Hessian from one
+        // Exp on a Dual2 (and from ExpDualN) against the closed forms
+        using D = Dual2<F, 2>;
+        std::vector<D> args;
+        for (F currentX = a_l; currentX <= a_r; currentX += a_step) {
+            D x = D::variable(currentX, 0), y = D::variable(0.5, 1);
+            args.push_back(x * y + x * static_cast<F>(0.25));
+        }
+        // relative to e (1 + t^2), the size of the largest component
+        auto error = [](const D &f, F t) {
+            F e = std::exp(static_cast<F>(0.75) * t);
+            std::array<F, 6> want = {
+                e, e * 0.75f, e * t, e * 0.5625f, e * (1 + 0.75f * t), e * t * t
+            };
+            std::array<F, 6> got = {
+                f.val,
+                f.grad[0],
+                f.grad[1],
+                f.hess[D::index(0, 0)],
+                f.hess[D::index(0, 1)],
+                f.hess[D::index(1, 1)]
+            };
+            F res = 0;
+            for (size_t k = 0; k < want.size(); ++k) {
+                res = std::max(std::abs(got[k] - want[k]) / (e * (1 + t * t)), res);
+            }
+            return res;
+        };
+        F scalarError = 0, batchError = 0;
+        std::vector<D> batch(args.size());
+        if constexpr (!std::is_same_v<F, long double>) {
+            ExpDualN<D>(args, batch);
+        }
+        for (size_t i = 0; i < args.size(); ++i) {
+            F t = args[i].grad[1];  // d(xy + x/4)/dy = x
+            D f = Exp<Method::Pade, F, Capacity>(args[i]);
+            scalarError = std::max(error(f, t), scalarError);
+            if constexpr (!std::is_same_v<F, long double>) {
+                batchError = std::max(error(batch[i], t), batchError);
+            }
+        }
+        std::cout << "=> DUAL2      | Max relative error: " << scalarError;
+        if constexpr (!std::is_same_v<F, long double>) {
+            std::cout << ", ExpDualN: " << batchError;
+        }
+        std::cout << std::endl;
+    }
+    if constexpr (std::is_same_v<F, double>) {
+        // hi + lo against expl: bounded by the 64-bit reference, not by ExpDD
+        long double relError = 0.0;
+        for (F currentX = a_l; currentX <= a_r; currentX += a_step) {
+            DoubleDouble y = ExpDD(currentX);
+            long double stdExp = std::exp(static_cast<long double>(currentX));
+            long double sum = static_cast<long double>(y.hi) + y.lo;
+            relError = std::max(std::abs(sum - stdExp) / stdExp, relError);
+        }
+        std::cout << "=> DD         | Max relative error: " << relError
                   << std::endl;
     }
+    {
+        // the whole range with a normal result (the reference in F too), in
+        // units of Eps<F>: the reduction error grows with |n| unless n * ln2
+        // is subtracted exactly
+        const F lo = std::log(std::numeric_limits<F>::min());
+        const F hi = std::log(std::numeric_limits<F>::max()) - 1;
+        const int Points = 1 << 14;
+        long double modfError = 0, codyWaiteError = 0;
+        for (int i = 0; i <= Points; ++i) {
+            F x = lo + (hi - lo) * static_cast<F>(i) / Points;
+            long double ref = std::exp(static_cast<long double>(x));
+            auto error = [&](F y) {
+                return std::abs(static_cast<long double>(y) - ref) / ref / Eps<F>;
+            };
+            modfError = std::max(error(Exp<Method::Pade, F, Capacity>(x)), modfError);
+            codyWaiteError = std::max(
+                error(Exp<Method::Pade,
+                          F,
+                          Capacity,
+                          Scheme::Horner,
+                          Reduction::CodyWaite>(x)),
+                codyWaiteError
+            );
+        }
+        std::cout << "=> FULL RANGE | [" << lo << ", " << hi
+                  << "], max relative error / eps: Modf " << modfError
+                  << ", CodyWaite " << codyWaiteError << std::endl;
+    }
+#ifdef ADAAI_HAVE_GSL
+    {
+        // the header-only coefficient set-up against the GSL solvers
+        constexpr auto &cheb = ChebyshevCoef<F>;
+        std::vector<F> chebGsl(cheb.size());
+        solveChebyshev(static_cast<int>(cheb.size()) - 1, chebGsl);
+        F chebDiff = 0;
+        for (size_t i = 0; i < cheb.size(); ++i) {
+            chebDiff = std::max(std::abs(cheb[i] - chebGsl[i]), chebDiff);
+        }
+
+        std::vector<F> coef_fft(1024, 0);
+        chebyshevGaussQuadrature(1023, coef_fft);
+        std::vector<F> samples = fourierSamples(coef_fft);
+        std::vector<F> samplesGsl = fourierSamplesGsl(coef_fft);
+        F fftDiff = 0;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            fftDiff = std::max(std::abs(samples[i] - samplesGsl[i]), fftDiff);
+        }
+        std::cout << "=> GSL CHECK  | Chebyshev coefficients: " << chebDiff
+                  << ", Fourier samples: " << fftDiff << std::endl;
+    }
+#endif
     std::cout << std::endl;
 }
 }  // namespace ADAAI
@@ -0,0 +1,55 @@
+// Runs (or reads from the cache) the Exp auto-tuner for float, double and
+// long double and prints the bound methods; exits with 1 when a type has no
+// method within the bound:
+//
+//   ./exp-tune [--ulp U] [--cache FILE | --no-cache]
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "autotune.hpp"
+
+using namespace ADAAI;
+
+// false when no method meets the bound
+template <typename F>
+bool report(const char *a_typename, double a_max_ulp, const std::string &a_cache) {
+    std::optional<TunedExp<F>> t = tunedExp<F>(a_max_ulp, a_cache);
+    if (!t) {
+        std::cout << "=> " << a_typename << ": no method within " << a_max_ulp << " ulp"
+                  << std::endl;
+        return false;
+    }
+    F one = 1, y = 0;
+    t->array(&one, &y, 1);
+    std::cout << "=> " << a_typename << ": scalar " << t->scalar_name << ", array "
+              << t->array_name << (t->from_cache ? " (cached)" : " (measured)")
+              << ", exp(1) = " << t->scalar(one) << " / " << y << std::endl;
+    return true;
+}
+
+int main(int argc, char **argv) {
+    double max_ulp = 4;
+    std::string cache = tune::defaultCachePath();
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ulp") == 0 && i + 1 < argc) {
+            max_ulp = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            cache = argv[++i];
+        } else if (std::strcmp(argv[i], "--no-cache") == 0) {
+            cache.clear();
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--ulp U] [--cache FILE | --no-cache]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout.precision(17);
+    std::cout << "=== EXP AUTO-TUNING: " << tune::cpuModel() << ", max " << max_ulp
+              << " ulp, cache " << (cache.empty() ? "off" : cache) << " ===" << std::endl;
+    bool ok = report<float>("float", max_ulp, cache);
+    ok = report<double>("double", max_ulp, cache) && ok;
+    ok = report<long double>("long double", max_ulp, cache) && ok;
+    return ok ? 0 : 1;
+}
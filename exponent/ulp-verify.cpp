@@ -0,0 +1,197 @@
+// Exhaustive ulp verifier for float: runs every method over all 2^32 bit
+// patterns (or every stride-th one), compares with expl rounded to float and
+// prints the ulp histogram and the worst inputs per method. The bit space is
+// cut into fixed chunks that threads take from a shared counter; per-chunk
+// statistics are merged in chunk order, so the report does not depend on the
+// number of threads.
+//
+//   ./ulp-verify [--threads N] [--stride S] [--worst K] [method ...]
+//
+// methods: taylor taylor-cw minimax pade chebyshev table table-cw fourier simd
+// (default: all); the -cw variants use Reduction::CodyWaite
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "exp.hpp"
+#include "exp_simd.hpp"
+#include "ulp.hpp"
+
+using namespace ADAAI;
+
+namespace {
+
+constexpr size_t Capacity = 50;
+constexpr uint64_t Patterns = uint64_t(1) << 32;
+constexpr uint64_t ChunkPatterns = uint64_t(1) << 24;
+constexpr size_t Block = 1024;
+
+// evaluates a method on a block of inputs
+using BlockExp = std::function<void(const float *, float *, size_t)>;
+
+template <Method M, Reduction R = Reduction::Modf>
+BlockExp scalarMethod(std::span<const float> coefs_fft = {}) {
+    return [coefs_fft](const float *x, float *y, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            y[i] = Exp<M, float, Capacity, Scheme::Horner, R>(x[i], coefs_fft);
+        }
+    };
+}
+
+struct Named {
+    std::string name;
+    BlockExp exp;
+};
+
+std::vector<Named> allMethods(std::span<const float> samples) {
+    return {
+        {"taylor", scalarMethod<Method::Taylor>()},
+        {"taylor-cw", scalarMethod<Method::Taylor, Reduction::CodyWaite>()},
+        {"minimax", scalarMethod<Method::Minimax>()},
+        {"pade", scalarMethod<Method::Pade>()},
+        {"chebyshev", scalarMethod<Method::Chebyshev>()},
+        {"table", scalarMethod<Method::Table>()},
+        {"table-cw", scalarMethod<Method::Table, Reduction::CodyWaite>()},
+        {"fourier", scalarMethod<Method::Fourier>(samples)},
+        {"simd",
+         [](const float *x, float *y, size_t n) {
+             ExpN<float>({x, n}, {y, n});
+         }},
+    };
+}
+
+// statistics of every method over the sampled patterns of one chunk
+void sweepChunk(
+    uint64_t a_chunk,
+    uint64_t a_stride,
+    const std::vector<Named> &a_methods,
+    std::vector<UlpStats<float>> &a_stats
+) {
+    float x[Block], y[Block];
+    long double ref[Block];
+
+    uint64_t begin = a_chunk * ChunkPatterns;
+    uint64_t end = begin + ChunkPatterns;
+    // first multiple of the stride in the chunk
+    uint64_t bits = (begin + a_stride - 1) / a_stride * a_stride;
+    while (bits < end) {
+        size_t n = 0;
+        for (; n < Block && bits < end; ++n, bits += a_stride) {
+            x[n] = std::bit_cast<float>(static_cast<uint32_t>(bits));
+            ref[n] = std::exp(static_cast<long double>(x[n]));
+        }
+        for (size_t m = 0; m < a_methods.size(); ++m) {
+            a_methods[m].exp(x, y, n);
+            for (size_t i = 0; i < n; ++i) {
+                a_stats[m].add(x[i], y[i], ref[i]);
+            }
+        }
+    }
+}
+
+void report(const std::string &a_name, const UlpStats<float> &a_stats) {
+    std::cout << "=> " << std::left << std::setw(10) << a_name << std::right
+              << "| max error " << std::setprecision(4) << a_stats.max_error
+              << " ulp over " << a_stats.count << " inputs" << std::endl;
+    std::cout << "   histogram:";
+    for (size_t k = 0; k < UlpStats<float>::Buckets; ++k) {
+        bool last = k + 1 == UlpStats<float>::Buckets;
+        std::cout << "  " << k << (last ? "+" : "") << ": " << a_stats.histogram[k];
+    }
+    std::cout << std::endl << "   worst:" << std::setprecision(9);
+    for (const auto &[err, x] : a_stats.worst) {
+        std::cout << "  " << x << " (" << std::setprecision(4) << err << ")"
+                  << std::setprecision(9);
+    }
+    std::cout << std::endl;
+}
+
+int usage(const char *a_argv0) {
+    std::cerr << "usage: " << a_argv0
+              << " [--threads N] [--stride S] [--worst K] [method ...]\n"
+                 "methods: taylor taylor-cw minimax pade chebyshev table table-cw "
+                 "fourier simd"
+              << std::endl;
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t stride = 1;
+    size_t keep = 8;
+    std::vector<std::string> wanted;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--stride") == 0 && i + 1 < argc) {
+            stride = std::max(1ull, std::strtoull(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--worst") == 0 && i + 1 < argc) {
+            keep = std::strtoul(argv[++i], nullptr, 10);
+        } else if (argv[i][0] == '-') {
+            return usage(argv[0]);
+        } else {
+            wanted.emplace_back(argv[i]);
+        }
+    }
+
+    std::vector<float> coef_fft(1024, 0);
+    chebyshevGaussQuadrature(1023, coef_fft);
+    std::vector<float> samples = fourierSamples(coef_fft);
+
+    std::vector<Named> methods;
+    for (Named &m : allMethods(samples)) {
+        if (wanted.empty() ||
+            std::find(wanted.begin(), wanted.end(), m.name) != wanted.end()) {
+            methods.push_back(std::move(m));
+        }
+    }
+    if (!wanted.empty() && methods.size() != wanted.size()) {
+        return usage(argv[0]);
+    }
+
+    const uint64_t chunks = Patterns / ChunkPatterns;
+    UlpStats<float> empty;
+    empty.keep = keep;
+    std::vector<std::vector<UlpStats<float>>> stats(
+        chunks, std::vector<UlpStats<float>>(methods.size(), empty)
+    );
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<uint64_t> next = 0;
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            for (uint64_t c; (c = next++) < chunks;) {
+                sweepChunk(c, stride, methods, stats[c]);
+            }
+        });
+    }
+    for (std::thread &t : pool) {
+        t.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "=== FLOAT ULP SWEEP: stride " << stride << ", " << threads
+              << " threads, " << std::setprecision(3) << elapsed.count() << " s ==="
+              << std::endl;
+    for (size_t m = 0; m < methods.size(); ++m) {
+        UlpStats<float> total = empty;
+        for (uint64_t c = 0; c < chunks; ++c) {
+            total.merge(stats[c][m]);
+        }
+        report(methods[m].name, total);
+    }
+    return 0;
+}
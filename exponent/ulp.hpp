@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ADAAI {
+
+// integer type with the size of F, used to walk the representable numbers
+template <typename F>
+using BitsOf = std::conditional_t<sizeof(F) == 4, int32_t, int64_t>;
+
+// position of a_x on the line of representable numbers: neighbours differ by
+// one, +0 and -0 coincide, infinities sit right after the largest finite values
+template <typename F>
+constexpr inline int64_t OrderedBits(F a_x) {
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>);
+    using I = BitsOf<F>;
+    I i = std::bit_cast<I>(a_x);
+    I magnitude = i & std::numeric_limits<I>::max();
+    return i < 0 ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+}
+
+// number of representable values between a and b; two NaNs are 0 apart,
+// a NaN and a number are "infinitely" far
+template <typename F>
+constexpr inline uint64_t UlpDistance(F a, F b) {
+    if (a != a || b != b) {
+        return (a != a && b != b) ? 0 : std::numeric_limits<uint64_t>::max();
+    }
+    int64_t d = OrderedBits(a) - OrderedBits(b);
+    return d < 0 ? -static_cast<uint64_t>(d) : static_cast<uint64_t>(d);
+}
+
+// |a_y - a_ref| in units in the last place of F at a_ref, with a_ref computed
+// in a wider type. Past the overflow threshold or at zero the ulp is undefined,
+// there the distance to the rounded reference is returned instead (for long
+// double only "equal" or "infinitely far").
+template <typename F>
+inline long double UlpError(F a_y, long double a_ref) {
+    F rounded = static_cast<F>(a_ref);
+    if (a_y != a_y || rounded != rounded || rounded == 0 || std::isinf(rounded)) {
+        if constexpr (std::is_same_v<F, long double>) {
+            bool same = a_y == rounded || (a_y != a_y && rounded != rounded);
+            return same ? 0 : std::numeric_limits<long double>::infinity();
+        } else {
+            uint64_t d = UlpDistance(a_y, rounded);
+            return d == std::numeric_limits<uint64_t>::max()
+                       ? std::numeric_limits<long double>::infinity()
+                       : static_cast<long double>(d);
+        }
+    }
+    constexpr int Digits = std::numeric_limits<F>::digits;
+    constexpr int MinExp = std::numeric_limits<F>::min_exponent;
+    int e = std::max(std::ilogb(rounded), MinExp - 1);
+    long double ulp = std::ldexp(1.0L, e - (Digits - 1));
+    return std::abs(static_cast<long double>(a_y) - a_ref) / ulp;
+}
+
+// ulp error statistics of one method over a set of inputs; per-thread
+// instances are combined with merge()
+template <typename F>
+struct UlpStats {
+    // histogram[k] counts results k ulp away from the rounded reference,
+    // the last bucket everything from Buckets - 1 ulp on
+    static constexpr size_t Buckets = 8;
+
+    std::array<uint64_t, Buckets> histogram = {};
+    uint64_t count = 0;
+    long double max_error = 0;
+    // (error in ulp, input), largest first, at most `keep` entries
+    std::vector<std::pair<long double, F>> worst;
+    size_t keep = 8;
+
+    void add(F a_x, F a_y, long double a_ref) {
+        uint64_t d = UlpDistance(a_y, static_cast<F>(a_ref));
+        histogram[std::min<uint64_t>(d, Buckets - 1)]++;
+        count++;
+
+        long double err = UlpError(a_y, a_ref);
+        max_error = std::max(max_error, err);
+        if (keep > 0 && (worst.size() < keep || err > worst.back().first)) {
+            insertWorst(err, a_x);
+        }
+    }
+
+    void merge(const UlpStats &a_other) {
+        for (size_t k = 0; k < Buckets; ++k) {
+            histogram[k] += a_other.histogram[k];
+        }
+        count += a_other.count;
+        max_error = std::max(max_error, a_other.max_error);
+        for (const auto &[err, x] : a_other.worst) {
+            if (keep > 0 && (worst.size() < keep || err > worst.back().first)) {
+                insertWorst(err, x);
+            }
+        }
+    }
+
+private:
+    void insertWorst(long double a_err, F a_x) {
+        auto pos = std::upper_bound(
+            worst.begin(), worst.end(), a_err,
+            [](long double e, const auto &w) { return e > w.first; }
+        );
+        worst.insert(pos, {a_err, a_x});
+        if (worst.size() > keep) {
+            worst.pop_back();
+        }
+    }
+};
+
+}  // namespace ADAAI